@@ -42,11 +42,11 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
         using AvrGdb::CommandPackets::FlashDone;
 
         if (rawPacket.size() >= 2) {
-            if (rawPacket[1] == 'm') {
+            if (rawPacket[1] == 'm' || rawPacket[1] == 'x') {
                 return std::make_unique<ReadMemory>(rawPacket);
             }
 
-            if (rawPacket[1] == 'M') {
+            if (rawPacket[1] == 'M' || rawPacket[1] == 'X') {
                 return std::make_unique<WriteMemory>(rawPacket);
             }
 
@@ -80,6 +80,11 @@ namespace Bloom::DebugServer::Gdb::AvrGdb
             Feature::MEMORY_MAP_READ, std::nullopt
         });
 
+        // Binary memory reads, via the 'x' packet
+        supportedFeatures.insert({
+            Feature::BINARY_UPLOAD, std::nullopt
+        });
+
         return supportedFeatures;
     }
 }
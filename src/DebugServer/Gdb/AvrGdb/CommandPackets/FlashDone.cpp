@@ -22,9 +22,29 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
     void FlashDone::handle(DebugSession& debugSession, TargetControllerConsole& targetControllerConsole) {
         Logger::debug("Handling FlashDone packet");
 
+        auto flashWriteFailed = false;
+
+        if (debugSession.flashWritePipeline.has_value()) {
+            try {
+                debugSession.flashWritePipeline->complete(targetControllerConsole);
+
+            } catch (const Exception& exception) {
+                Logger::error("Failed to write to flash memory - " + exception.getMessage());
+                flashWriteFailed = true;
+            }
+
+            debugSession.flashWritePipeline = std::nullopt;
+        }
+
         try {
+            // We leave programming mode regardless of whether the writes succeeded
             targetControllerConsole.disableProgrammingMode();
 
+            if (flashWriteFailed) {
+                debugSession.connection.writePacket(ErrorResponsePacket());
+                return;
+            }
+
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
@@ -52,13 +52,17 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
         Logger::debug("Handling FlashErase packet");
 
         try {
-            targetControllerConsole.enableProgrammingMode();
-
-            targetControllerConsole.writeMemory(
-                Targets::TargetMemoryType::FLASH,
-                this->startAddress,
-                Targets::TargetMemoryBuffer(this->bytes, 0xFF)
-            );
+            if (!debugSession.flashWritePipeline.has_value()) {
+                targetControllerConsole.enableProgrammingMode();
+                debugSession.flashWritePipeline.emplace(debugSession.gdbTargetDescriptor.targetDescriptor);
+            }
+
+            /*
+             * We don't erase anything just yet. GDB will usually go on to write to most of the region, so the pipeline
+             * defers the erase until GDB has finished (see FlashDone::handle()), and only erases what hasn't been
+             * written.
+             */
+            debugSession.flashWritePipeline->erase(this->startAddress, this->bytes);
 
             debugSession.connection.writePacket(OkResponsePacket());
 
@@ -52,13 +52,17 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
         Logger::debug("Handling FlashWrite packet");
 
         try {
-            targetControllerConsole.enableProgrammingMode();
-
-            targetControllerConsole.writeMemory(
-                Targets::TargetMemoryType::FLASH,
-                this->startAddress,
-                this->buffer
-            );
+            if (!debugSession.flashWritePipeline.has_value()) {
+                targetControllerConsole.enableProgrammingMode();
+                debugSession.flashWritePipeline.emplace(debugSession.gdbTargetDescriptor.targetDescriptor);
+            }
+
+            /*
+             * The write is serviced asynchronously - we respond to GDB without waiting for it, so that the next packet
+             * can be received whilst the target is being programmed. Failures are reported in response to the
+             * "vFlashDone" packet.
+             */
+            debugSession.flashWritePipeline->write(this->startAddress, this->buffer, targetControllerConsole);
 
             debugSession.connection.writePacket(OkResponsePacket());
 
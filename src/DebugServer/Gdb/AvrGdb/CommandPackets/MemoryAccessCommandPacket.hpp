@@ -2,6 +2,8 @@
 
 #include <cstdint>
 #include <optional>
+#include <vector>
+#include <algorithm>
 
 #include "src/DebugServer/Gdb/CommandPackets/CommandPacket.hpp"
 
@@ -27,6 +29,16 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
         {};
 
     protected:
+        /**
+         * The maximum number of bytes to access via a single TargetController command.
+         *
+         * GDB can request large memory accesses in a single packet (see GdbRspDebugServer::getMaximumPacketSize()).
+         * We split these into multiple commands, which are issued together so that the TargetController can service
+         * them back to back. This is a multiple of every AVR flash page size, so accesses that are aligned to it are
+         * also page aligned.
+         */
+        static constexpr std::uint32_t MAXIMUM_ACCESS_SIZE = 1024;
+
         /**
          * The mask used by the AVR GDB client to encode the memory type into memory addresses.
          */
@@ -58,5 +70,32 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
                 ? (address & ~(MemoryAccessCommandPacket::AVR_GDB_MEMORY_ADDRESS_MASK))
                 : address;
         }
+
+        /**
+         * Splits a memory access into address ranges of no more than MAXIMUM_ACCESS_SIZE bytes. All ranges, except
+         * the first, begin on a MAXIMUM_ACCESS_SIZE boundary.
+         *
+         * @param startAddress
+         * @param bytes
+         * @return
+         */
+        static std::vector<Targets::TargetMemoryAddressRange> splitAccess(
+            std::uint32_t startAddress,
+            std::uint32_t bytes
+        ) {
+            auto output = std::vector<Targets::TargetMemoryAddressRange>();
+            const auto endAddress = startAddress + bytes;
+
+            for (auto address = startAddress; address < endAddress;) {
+                const auto nextBoundary = ((address / MemoryAccessCommandPacket::MAXIMUM_ACCESS_SIZE) + 1)
+                    * MemoryAccessCommandPacket::MAXIMUM_ACCESS_SIZE;
+                const auto rangeEndAddress = std::min(nextBoundary, endAddress);
+
+                output.emplace_back(address, rangeEndAddress - 1);
+                address = rangeEndAddress;
+            }
+
+            return output;
+        }
     };
 }
@@ -1,5 +1,7 @@
 #include "ReadMemory.hpp"
 
+#include <deque>
+
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
 
@@ -22,13 +24,15 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             throw Exception("Invalid packet length");
         }
 
+        this->binary = this->data[0] == 'x';
+
         auto packetString = QString::fromLocal8Bit(
             reinterpret_cast<const char*>(this->data.data() + 1),
             static_cast<int>(this->data.size() - 1)
         );
 
         /*
-         * The read memory ('m') packet consists of two segments, an address and a number of bytes to read.
+         * The read memory ('m' and 'x') packets consist of two segments, an address and a number of bytes to read.
          * These are separated by a comma character.
          */
         auto packetSegments = packetString.split(",");
@@ -68,7 +72,9 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
 
             if (this->bytes == 0) {
                 debugSession.connection.writePacket(
-                    ResponsePacket(std::vector<unsigned char>())
+                    this->binary
+                        ? ResponsePacket(std::vector<unsigned char>({'b'}))
+                        : ResponsePacket(std::vector<unsigned char>())
                 );
                 return;
             }
@@ -119,11 +125,25 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             auto memoryBuffer = Targets::TargetMemoryBuffer();
 
             if (bytesToRead > 0) {
-                memoryBuffer = targetControllerConsole.readMemory(
-                    this->memoryType,
-                    this->startAddress,
-                    bytesToRead
-                );
+                auto pendingReads = std::deque<
+                    TargetController::PendingResponse<TargetController::Commands::ReadTargetMemory>
+                >();
+
+                for (const auto& addressRange : ReadMemory::splitAccess(this->startAddress, bytesToRead)) {
+                    pendingReads.emplace_back(targetControllerConsole.readMemoryAsync(
+                        this->memoryType,
+                        addressRange.startAddress,
+                        (addressRange.endAddress - addressRange.startAddress) + 1
+                    ));
+                }
+
+                // Leave room for the prefix of binary responses
+                memoryBuffer.reserve(this->bytes + 1);
+
+                for (auto& pendingRead : pendingReads) {
+                    const auto response = debugSession.waitForResponse(pendingRead);
+                    memoryBuffer.insert(memoryBuffer.end(), response->data.begin(), response->data.end());
+                }
             }
 
             if (bytesToRead < this->bytes) {
@@ -131,6 +151,13 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
                 memoryBuffer.insert(memoryBuffer.end(), (this->bytes - bytesToRead), 0x00);
             }
 
+            if (this->binary) {
+                // Any characters that require escaping will be escaped in ResponsePacket::toRawPacket()
+                memoryBuffer.insert(memoryBuffer.begin(), 'b');
+                debugSession.connection.writePacket(ResponsePacket(memoryBuffer));
+                return;
+            }
+
             debugSession.connection.writePacket(
                 ResponsePacket(Packet::toHex(memoryBuffer))
             );
@@ -8,8 +8,12 @@
 namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
 {
     /**
-     * The ReadMemory class implements a structure for "m" packets. Upon receiving these packets, the server is
+     * The ReadMemory class implements a structure for "m" and "x" packets. Upon receiving these packets, the server is
      * expected to read memory from the target and send it the client.
+     *
+     * The response to an "m" packet carries hex-encoded data, whereas the response to an "x" packet carries binary
+     * data (prefixed with a 'b' character). The "x" packet is only used by GDB clients that support the
+     * "binary-upload" feature.
      */
     class ReadMemory: public MemoryAccessCommandPacket
     {
@@ -29,6 +33,11 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
          */
         std::uint32_t bytes = 0;
 
+        /**
+         * Whether the client expects the data in binary form ("x" packet).
+         */
+        bool binary = false;
+
         explicit ReadMemory(const RawPacketType& rawPacket);
 
         void handle(
@@ -1,5 +1,7 @@
 #include "WriteMemory.hpp"
 
+#include <algorithm>
+
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 
@@ -22,15 +24,23 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
             throw Exception("Invalid packet length");
         }
 
+        /*
+         * The write memory ('M' and 'X') packets consist of three segments, an address, a length and a buffer.
+         * The address and length are separated by a comma character, and the buffer proceeds a colon character.
+         *
+         * The buffer of an 'X' packet is binary, and can contain any character, so we only parse the address and
+         * length as a string.
+         */
+        const auto bufferSeparatorIt = std::find(this->data.begin() + 1, this->data.end(), ':');
+        if (bufferSeparatorIt == this->data.end()) {
+            throw Exception("Missing buffer segment in write memory packet data");
+        }
+
         auto packetString = QString::fromLocal8Bit(
             reinterpret_cast<const char*>(this->data.data() + 1),
-            static_cast<int>(this->data.size() - 1)
+            static_cast<int>(bufferSeparatorIt - (this->data.begin() + 1))
         );
 
-        /*
-         * The write memory ('M') packet consists of three segments, an address, a length and a buffer.
-         * The address and length are separated by a comma character, and the buffer proceeds a colon character.
-         */
         auto packetSegments = packetString.split(",");
         if (packetSegments.size() != 2) {
             throw Exception(
@@ -48,20 +58,18 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
         this->memoryType = this->getMemoryTypeFromGdbAddress(gdbStartAddress);
         this->startAddress = this->removeMemoryTypeIndicatorFromGdbAddress(gdbStartAddress);
 
-        auto lengthAndBufferSegments = packetSegments.at(1).split(":");
-        if (lengthAndBufferSegments.size() != 2) {
-            throw Exception(
-                "Unexpected number of segments in packet data: "
-                    + std::to_string(lengthAndBufferSegments.size())
-            );
-        }
-
-        auto bufferSize = lengthAndBufferSegments.at(0).toUInt(&conversionStatus, 16);
+        auto bufferSize = packetSegments.at(1).toUInt(&conversionStatus, 16);
         if (!conversionStatus) {
             throw Exception("Failed to parse write length from write memory packet data");
         }
 
-        this->buffer = Packet::hexToData(lengthAndBufferSegments.at(1).toStdString());
+        if (this->data[0] == 'X') {
+            // Any escaped bytes will have been unescaped upon receipt of the packet
+            this->buffer = Targets::TargetMemoryBuffer(bufferSeparatorIt + 1, this->data.end());
+
+        } else {
+            this->buffer = Packet::hexToData(std::string(bufferSeparatorIt + 1, this->data.end()));
+        }
 
         if (this->buffer.size() != bufferSize) {
             throw Exception("Buffer size does not match length value given in write memory packet");
@@ -102,12 +110,30 @@ namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
                 );
             }
 
-            targetControllerConsole.writeMemory(
-                this->memoryType,
+            const auto addressRanges = WriteMemory::splitAccess(
                 this->startAddress,
-                this->buffer
+                static_cast<std::uint32_t>(this->buffer.size())
             );
 
+            /*
+             * Each chunk is written only once the previous chunk's write has succeeded - if one fails, the remaining
+             * chunks must not be written.
+             */
+            for (const auto& addressRange : addressRanges) {
+                const auto bufferOffset = addressRange.startAddress - this->startAddress;
+
+                auto pendingWrite = targetControllerConsole.writeMemoryAsync(
+                    this->memoryType,
+                    addressRange.startAddress,
+                    Targets::TargetMemoryBuffer(
+                        this->buffer.begin() + bufferOffset,
+                        this->buffer.begin() + bufferOffset + (addressRange.endAddress - addressRange.startAddress) + 1
+                    )
+                );
+
+                debugSession.waitForResponse(pendingWrite);
+            }
+
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
@@ -8,8 +8,11 @@
 namespace Bloom::DebugServer::Gdb::AvrGdb::CommandPackets
 {
     /**
-     * The WriteMemory class implements the structure for "M" packets. Upon receiving this packet, the server is
-     * expected to write data to the target's memory, at the specified start address.
+     * The WriteMemory class implements the structure for "M" and "X" packets. Upon receiving these packets, the
+     * server is expected to write data to the target's memory, at the specified start address.
+     *
+     * The two packets differ only in the encoding of the data - "M" packets carry hex-encoded data, whereas "X"
+     * packets carry binary data.
      */
     class WriteMemory: public MemoryAccessCommandPacket
     {
@@ -0,0 +1,23 @@
+#include "StartNoAckMode.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    using TargetController::TargetControllerConsole;
+
+    using ResponsePackets::OkResponsePacket;
+
+    void StartNoAckMode::handle(DebugSession& debugSession, TargetControllerConsole& targetControllerConsole) {
+        Logger::debug("Handling StartNoAckMode packet");
+
+        /*
+         * The client will still acknowledge our response to this packet - acknowledgements cease once it has been
+         * received.
+         */
+        debugSession.connection.writePacket(OkResponsePacket());
+        debugSession.connection.disableAcknowledgements();
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace Bloom::DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The StartNoAckMode class implements a structure for the "QStartNoAckMode" packet. Upon receiving this packet,
+     * the server and client stop acknowledging (with '+') each other's packets, for the remainder of the connection.
+     */
+    class StartNoAckMode: public CommandPacket
+    {
+    public:
+        explicit StartNoAckMode(const RawPacketType& rawPacket): CommandPacket(rawPacket) {}
+
+        void handle(
+            DebugSession& debugSession,
+            TargetController::TargetControllerConsole& targetControllerConsole
+        ) override;
+    };
+}
@@ -51,86 +51,94 @@ namespace Bloom::DebugServer::Gdb
         return std::string(ipAddress.data());
     }
 
-    std::vector<RawPacketType> Connection::readRawPackets() {
-        std::vector<RawPacketType> output;
-
-        const auto bytes = this->read();
-
-        std::size_t bufferSize = bytes.size();
-        for (std::size_t byteIndex = 0; byteIndex < bufferSize; byteIndex++) {
-            auto byte = bytes[byteIndex];
-
-            if (byte == 0x03) {
-                /*
-                 * This is an interrupt packet - it doesn't carry any of the usual packet frame bytes, so we'll just
-                 * add them here, in order to keep things consistent.
-                 *
-                 * Because we're effectively faking the packet frame, we can use any value for the checksum.
-                 */
-                output.push_back({'$', byte, '#', 'F', 'F'});
-
-            } else if (byte == '$') {
-                // Beginning of packet
-                RawPacketType rawPacket;
-                rawPacket.push_back('$');
-
-                auto packetIndex = byteIndex;
-                bool validPacket = false;
-                bool isByteEscaped = false;
-
-                for (packetIndex++; packetIndex < bufferSize; packetIndex++) {
-                    byte = bytes[packetIndex];
-
-                    if (byte == '}' && !isByteEscaped) {
-                        isByteEscaped = true;
-                        continue;
-                    }
+    std::optional<RawPacketType> Connection::readRawPacket() {
+        if (this->pendingRawPackets.empty()) {
+            this->queueRawPackets(this->packetFramer.feed(this->read()));
+        }
 
-                    if (!isByteEscaped) {
-                        if (byte == '$') {
-                            // Unexpected end of packet
-                            validPacket = false;
-                            break;
-                        }
-
-                        if (byte == '#') {
-                            // End of packet data
-                            if ((bufferSize - 1) < (packetIndex + 2)) {
-                                // There should be at least two more bytes in the buffer, for the checksum.
-                                break;
-                            }
-
-                            rawPacket.push_back(byte);
-
-                            // Add the checksum bytes and break the loop
-                            rawPacket.push_back(bytes[++packetIndex]);
-                            rawPacket.push_back(bytes[++packetIndex]);
-                            validPacket = true;
-                            break;
-                        }
-
-                    } else {
-                        // Escaped bytes are XOR'd with a 0x20 mask.
-                        byte ^= 0x20;
-                        isByteEscaped = false;
-                    }
+        if (this->pendingRawPackets.empty()) {
+            return std::nullopt;
+        }
+
+        auto rawPacket = std::move(this->pendingRawPackets.front());
+        this->pendingRawPackets.pop();
+
+        return rawPacket;
+    }
 
-                    rawPacket.push_back(byte);
+    bool Connection::waitForNotification(
+        EventFdNotifier& notifier,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        if (this->takePendingInterrupt()) {
+            return false;
+        }
+
+        const auto deadline = timeout.has_value()
+            ? std::optional(std::chrono::steady_clock::now() + timeout.value())
+            : std::nullopt;
+
+        this->epollInstance.addEntry(
+            notifier.getFileDescriptor(),
+            static_cast<std::uint16_t>(EpollEvent::READ_READY)
+        );
+
+        try {
+            while (true) {
+                auto remainingTime = std::optional<std::chrono::milliseconds>();
+
+                if (deadline.has_value()) {
+                    const auto now = std::chrono::steady_clock::now();
+                    remainingTime = deadline.value() > now
+                        ? std::chrono::duration_cast<std::chrono::milliseconds>(deadline.value() - now)
+                        : std::chrono::milliseconds(0);
+                }
+
+                const auto eventFileDescriptor = this->epollInstance.waitForEvent(remainingTime);
+
+                if (!eventFileDescriptor.has_value() || eventFileDescriptor.value() == notifier.getFileDescriptor()) {
+                    break;
                 }
 
-                if (validPacket) {
-                    // Acknowledge receipt
-                    this->write({'+'});
+                if (eventFileDescriptor.value() == this->interruptEventNotifier.getFileDescriptor()) {
+                    this->interruptEventNotifier.clear();
+                    throw DebugServerInterrupted();
+                }
+
+                auto buffer = std::array<unsigned char, 1024>();
+                const auto bytesRead = ::read(this->socketFileDescriptor.value(), buffer.data(), buffer.size());
+
+                if (bytesRead == 0) {
+                    throw ClientDisconnected();
+                }
+
+                if (bytesRead < 0) {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                        continue;
+                    }
+
+                    throw ClientCommunicationError(
+                        "Failed to read from GDB client socket - error no: " + std::to_string(errno)
+                    );
+                }
 
-                    Logger::debug("Read GDB packet: " + std::string(rawPacket.begin(), rawPacket.end()));
+                this->queueRawPackets(this->packetFramer.feed(
+                    std::vector<unsigned char>(buffer.begin(), buffer.begin() + bytesRead)
+                ));
 
-                    output.emplace_back(std::move(rawPacket));
-                    byteIndex = packetIndex;
+                if (this->takePendingInterrupt()) {
+                    this->epollInstance.removeEntry(notifier.getFileDescriptor());
+                    return false;
                 }
             }
+
+        } catch (const std::exception&) {
+            this->epollInstance.removeEntry(notifier.getFileDescriptor());
+            throw;
         }
 
-        return output;
+        this->epollInstance.removeEntry(notifier.getFileDescriptor());
+        return true;
     }
 
     void Connection::writePacket(const ResponsePacket& packet) {
@@ -140,6 +148,11 @@ namespace Bloom::DebugServer::Gdb
 
         Logger::debug("Writing GDB packet: " + std::string(rawPacket.begin(), rawPacket.end()));
 
+        if (!this->acknowledgementsEnabled) {
+            this->write(rawPacket);
+            return;
+        }
+
         do {
             if (attempts > 10) {
                 throw ClientCommunicationError("Failed to write GDB response packet - client failed to "
@@ -151,6 +164,47 @@ namespace Bloom::DebugServer::Gdb
         } while (this->readSingleByte(false).value_or(0) != '+');
     }
 
+    void Connection::queueRawPackets(std::vector<RawPacketType>&& rawPackets) {
+        auto acknowledgements = std::vector<unsigned char>();
+
+        for (auto& rawPacket : rawPackets) {
+            const auto isInterrupt = rawPacket.size() == 5 && rawPacket[1] == 0x03;
+
+            if (this->acknowledgementsEnabled && !isInterrupt) {
+                acknowledgements.push_back('+');
+            }
+
+            Logger::debug("Read GDB packet: " + std::string(rawPacket.begin(), rawPacket.end()));
+            this->pendingRawPackets.push(std::move(rawPacket));
+        }
+
+        if (!acknowledgements.empty()) {
+            // Acknowledge receipt
+            this->write(acknowledgements);
+        }
+    }
+
+    bool Connection::takePendingInterrupt() {
+        auto remainingRawPackets = std::queue<RawPacketType>();
+        auto interruptFound = false;
+
+        while (!this->pendingRawPackets.empty()) {
+            auto& rawPacket = this->pendingRawPackets.front();
+
+            if (!interruptFound && rawPacket.size() == 5 && rawPacket[1] == 0x03) {
+                interruptFound = true;
+
+            } else {
+                remainingRawPackets.push(std::move(rawPacket));
+            }
+
+            this->pendingRawPackets.pop();
+        }
+
+        this->pendingRawPackets = std::move(remainingRawPackets);
+        return interruptFound;
+    }
+
     void Connection::accept(int serverSocketFileDescriptor) {
         int socketAddressLength = sizeof(this->socketAddress);
 
@@ -13,6 +13,7 @@
 #include "src/Helpers/EpollInstance.hpp"
 
 #include "src/DebugServer/Gdb/Packet.hpp"
+#include "src/DebugServer/Gdb/PacketFramer.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
 
 namespace Bloom::DebugServer::Gdb
@@ -39,6 +40,9 @@ namespace Bloom::DebugServer::Gdb
             , socketFileDescriptor(other.socketFileDescriptor)
             , epollInstance(std::move(other.epollInstance))
             , readInterruptEnabled(other.readInterruptEnabled)
+            , acknowledgementsEnabled(other.acknowledgementsEnabled)
+            , packetFramer(std::move(other.packetFramer))
+            , pendingRawPackets(std::move(other.pendingRawPackets))
         {
             other.socketFileDescriptor = std::nullopt;
         }
@@ -53,11 +57,35 @@ namespace Bloom::DebugServer::Gdb
         [[nodiscard]] std::string getIpAddress() const;
 
         /**
-         * Waits for incoming data from the client and returns the raw GDB packets.
+         * Returns the next raw GDB packet from the client.
+         *
+         * Packets are returned in the order in which they were received. If no complete packets are pending, this
+         * will wait for incoming data from the client.
+         *
+         * @return
+         *  The next packet, or std::nullopt if the data received from the client didn't complete a packet.
+         */
+        std::optional<RawPacketType> readRawPacket();
+
+        /**
+         * Waits for the given notifier to be notified, whilst watching for interrupts (0x03) from the client.
+         *
+         * Any other packets received from the client whilst waiting are queued, to be returned by subsequent calls
+         * to Connection::readRawPacket().
+         *
+         * @param notifier
+         *
+         * @param timeout
+         *  The timeout in milliseconds. If not supplied, no timeout will be applied.
          *
          * @return
+         *  False if the client sent an interrupt, true otherwise (the notifier was notified, or the timeout was
+         *  reached).
          */
-        std::vector<RawPacketType> readRawPackets();
+        bool waitForNotification(
+            EventFdNotifier& notifier,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
 
         /**
          * Sends a response packet to the client.
@@ -66,15 +94,20 @@ namespace Bloom::DebugServer::Gdb
          */
         void writePacket(const ResponsePackets::ResponsePacket& packet);
 
-        [[nodiscard]] int getMaxPacketSize() const {
-            return this->maxPacketSize;
+        /**
+         * Stops the acknowledgement of packets, in both directions. Once disabled, we no longer send '+' for each
+         * packet received, nor wait for the client to acknowledge each packet sent.
+         *
+         * This is triggered by the client, via the "QStartNoAckMode" packet.
+         */
+        void disableAcknowledgements() {
+            this->acknowledgementsEnabled = false;
         }
 
     private:
         std::optional<int> socketFileDescriptor;
 
         struct sockaddr_in socketAddress = {};
-        int maxPacketSize = 1024;
 
         /**
          * The interruptEventNotifier (instance of EventFdNotifier) allows us to interrupt blocking I/O calls on this
@@ -93,6 +126,34 @@ namespace Bloom::DebugServer::Gdb
 
         bool readInterruptEnabled = false;
 
+        /**
+         * See Connection::disableAcknowledgements().
+         */
+        bool acknowledgementsEnabled = true;
+
+        PacketFramer packetFramer;
+
+        /**
+         * Complete packets that have been received from the client, but not yet returned by
+         * Connection::readRawPacket().
+         */
+        std::queue<RawPacketType> pendingRawPackets;
+
+        /**
+         * Queues packets received from the client, acknowledging receipt of each (if acknowledgements are enabled).
+         *
+         * @param rawPackets
+         */
+        void queueRawPackets(std::vector<RawPacketType>&& rawPackets);
+
+        /**
+         * Removes the first pending interrupt packet from this->pendingRawPackets, if there is one.
+         *
+         * @return
+         *  True if an interrupt packet was removed.
+         */
+        bool takePendingInterrupt();
+
         /**
          * Accepts a connection on serverSocketFileDescriptor.
          *
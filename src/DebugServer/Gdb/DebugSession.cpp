@@ -12,11 +12,7 @@ namespace Bloom::DebugServer::Gdb
         : connection(std::move(connection))
         , supportedFeatures(supportedFeatures)
         , gdbTargetDescriptor(targetDescriptor)
-    {
-        this->supportedFeatures.insert({
-            Feature::PACKET_SIZE, std::to_string(this->connection.getMaxPacketSize())
-        });
-    }
+    {}
 
     void DebugSession::terminate() {
 
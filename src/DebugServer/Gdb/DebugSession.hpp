@@ -1,10 +1,17 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
+#include <chrono>
 
 #include "TargetDescriptor.hpp"
 #include "Connection.hpp"
 #include "Feature.hpp"
+#include "FlashWritePipeline.hpp"
+
+#include "src/TargetController/PendingResponse.hpp"
+#include "src/Helpers/EventFdNotifier.hpp"
+#include "src/Exceptions/Exception.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
@@ -33,6 +40,14 @@ namespace Bloom::DebugServer::Gdb
          */
         bool waitingForBreak = false;
 
+        /**
+         * The pipeline servicing the current flash operation, if one is in progress.
+         *
+         * A flash operation begins with the first "vFlashErase" or "vFlashWrite" packet, and ends with the
+         * "vFlashDone" packet. See the FlashWritePipeline class for more.
+         */
+        std::optional<FlashWritePipeline> flashWritePipeline;
+
         DebugSession(
             Connection&& connection,
             const std::set<std::pair<Feature, std::optional<std::string>>>& supportedFeatures,
@@ -40,5 +55,57 @@ namespace Bloom::DebugServer::Gdb
         );
 
         void terminate();
+
+        /**
+         * Waits for the TargetController's response to a command, whilst servicing interrupts (0x03) from the GDB
+         * client. Commands that take a while (large memory reads, for example) can therefore be abandoned by the
+         * client.
+         *
+         * If the client sends an interrupt before the response arrives, the command is cancelled and an exception is
+         * thrown.
+         *
+         * @param pendingResponse
+         *
+         * @return
+         *  The response, as returned by PendingResponse::get().
+         */
+        template<class CommandType>
+        auto waitForResponse(TargetController::PendingResponse<CommandType>& pendingResponse) {
+            /*
+             * The notifier must outlive the completion callback's registration - it's only released once the
+             * response has been collected or the command has been cancelled.
+             */
+            auto notifier = EventFdNotifier();
+
+            if (!pendingResponse.isReady()) {
+                pendingResponse.setCompletionCallback([&notifier] {
+                    notifier.notify();
+                });
+
+                const auto now = std::chrono::steady_clock::now();
+                const auto deadline = pendingResponse.getDeadline();
+                auto clientInterrupted = false;
+
+                try {
+                    clientInterrupted = !this->connection.waitForNotification(
+                        notifier,
+                        deadline > now
+                            ? std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now)
+                            : std::chrono::milliseconds(0)
+                    );
+
+                } catch (const std::exception&) {
+                    pendingResponse.cancel();
+                    throw;
+                }
+
+                if (clientInterrupted) {
+                    pendingResponse.cancel();
+                    throw Bloom::Exceptions::Exception("Interrupted by GDB client");
+                }
+            }
+
+            return pendingResponse.get();
+        }
     };
 }
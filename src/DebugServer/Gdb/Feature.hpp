@@ -10,6 +10,8 @@ namespace Bloom::DebugServer::Gdb
         HARDWARE_BREAKPOINTS,
         PACKET_SIZE,
         MEMORY_MAP_READ,
+        NO_ACK_MODE,
+        BINARY_UPLOAD,
     };
 
     static inline BiMap<Feature, std::string> getGdbFeatureToNameMapping() {
@@ -18,6 +20,8 @@ namespace Bloom::DebugServer::Gdb
             {Feature::SOFTWARE_BREAKPOINTS, "swbreak"},
             {Feature::PACKET_SIZE, "PacketSize"},
             {Feature::MEMORY_MAP_READ, "qXfer:memory-map:read"},
+            {Feature::NO_ACK_MODE, "QStartNoAckMode"},
+            {Feature::BINARY_UPLOAD, "binary-upload"},
         };
     }
 }
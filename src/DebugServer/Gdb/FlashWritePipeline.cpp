@@ -0,0 +1,281 @@
+#include "FlashWritePipeline.hpp"
+
+#include <algorithm>
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    using TargetController::TargetControllerConsole;
+
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetMemoryAddressRange;
+
+    using Exceptions::Exception;
+
+    FlashWritePipeline::FlashWritePipeline(const Targets::TargetDescriptor& targetDescriptor)
+        : memoryType(targetDescriptor.programMemoryType)
+    {
+        const auto memoryDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(this->memoryType);
+
+        if (
+            memoryDescriptorIt != targetDescriptor.memoryDescriptorsByType.end()
+            && memoryDescriptorIt->second.pageSize.has_value()
+            && memoryDescriptorIt->second.pageSize.value() > 0
+        ) {
+            this->pageSize = memoryDescriptorIt->second.pageSize.value();
+        }
+    }
+
+    void FlashWritePipeline::erase(std::uint32_t startAddress, std::uint32_t bytes) {
+        if (bytes == 0) {
+            return;
+        }
+
+        const auto eraseRange = TargetMemoryAddressRange(startAddress, startAddress + bytes - 1);
+
+        this->removePendingEraseRange(eraseRange);
+        this->pendingEraseRanges.insert(eraseRange);
+    }
+
+    void FlashWritePipeline::write(
+        std::uint32_t startAddress,
+        const TargetMemoryBuffer& buffer,
+        TargetControllerConsole& targetControllerConsole
+    ) {
+        if (buffer.empty()) {
+            return;
+        }
+
+        const auto endAddress = static_cast<std::uint32_t>(startAddress + buffer.size() - 1);
+        this->removePendingEraseRange(TargetMemoryAddressRange(startAddress, endAddress));
+
+        if (this->errorMessage.has_value()) {
+            // There's no point in writing anything more - the flash operation has already failed.
+            return;
+        }
+
+        auto completedPageAddresses = std::vector<std::uint32_t>();
+
+        for (auto address = startAddress; address <= endAddress;) {
+            const auto pageAddress = address - (address % this->pageSize);
+            const auto pageEndAddress = std::min(pageAddress + this->pageSize - 1, endAddress);
+
+            auto pageBufferIt = this->pageBuffersByAddress.find(pageAddress);
+            if (pageBufferIt == this->pageBuffersByAddress.end()) {
+                pageBufferIt = this->pageBuffersByAddress.insert(std::pair(
+                    pageAddress,
+                    PageBuffer{
+                        .data = TargetMemoryBuffer(this->pageSize, 0xFF),
+                        .populated = std::vector<bool>(this->pageSize, false),
+                    }
+                )).first;
+            }
+
+            auto& pageBuffer = pageBufferIt->second;
+
+            for (; address <= pageEndAddress; address++) {
+                const auto pageOffset = address - pageAddress;
+
+                pageBuffer.data[pageOffset] = buffer[address - startAddress];
+
+                if (!pageBuffer.populated[pageOffset]) {
+                    pageBuffer.populated[pageOffset] = true;
+                    pageBuffer.populatedBytes++;
+                }
+            }
+
+            if (pageBuffer.populatedBytes == this->pageSize) {
+                completedPageAddresses.push_back(pageAddress);
+            }
+
+            if (pageEndAddress == endAddress) {
+                break;
+            }
+        }
+
+        if (completedPageAddresses.empty()) {
+            return;
+        }
+
+        this->writePages(completedPageAddresses, targetControllerConsole);
+    }
+
+    void FlashWritePipeline::complete(TargetControllerConsole& targetControllerConsole) {
+        if (!this->errorMessage.has_value()) {
+            /*
+             * For any partially populated pages, the unpopulated bytes that fall within an erase range can be filled
+             * with 0xFF, as they would have been erased. That way, we can write the whole page in one go.
+             */
+            for (auto& [pageAddress, pageBuffer] : this->pageBuffersByAddress) {
+                for (const auto& eraseRange : this->pendingEraseRanges) {
+                    if (
+                        eraseRange.endAddress < pageAddress
+                        || eraseRange.startAddress > (pageAddress + this->pageSize - 1)
+                    ) {
+                        continue;
+                    }
+
+                    const auto fillStartOffset = std::max(eraseRange.startAddress, pageAddress) - pageAddress;
+                    const auto fillEndOffset = std::min(eraseRange.endAddress, pageAddress + this->pageSize - 1)
+                        - pageAddress;
+
+                    for (auto pageOffset = fillStartOffset; pageOffset <= fillEndOffset; pageOffset++) {
+                        if (!pageBuffer.populated[pageOffset]) {
+                            pageBuffer.populated[pageOffset] = true;
+                            pageBuffer.populatedBytes++;
+                        }
+                    }
+                }
+
+                this->removePendingEraseRange(
+                    TargetMemoryAddressRange(pageAddress, pageAddress + this->pageSize - 1)
+                );
+            }
+
+            auto completedPageAddresses = std::vector<std::uint32_t>();
+
+            for (auto& [pageAddress, pageBuffer] : this->pageBuffersByAddress) {
+                if (pageBuffer.populatedBytes == this->pageSize) {
+                    completedPageAddresses.push_back(pageAddress);
+                    continue;
+                }
+
+                // Write each populated segment of the page separately
+                auto segmentStartOffset = std::optional<std::uint32_t>();
+
+                for (auto pageOffset = std::uint32_t(0); pageOffset <= this->pageSize; pageOffset++) {
+                    const auto populated = pageOffset < this->pageSize && pageBuffer.populated[pageOffset];
+
+                    if (populated && !segmentStartOffset.has_value()) {
+                        segmentStartOffset = pageOffset;
+
+                    } else if (!populated && segmentStartOffset.has_value()) {
+                        this->issueWrite(
+                            pageAddress + segmentStartOffset.value(),
+                            TargetMemoryBuffer(
+                                pageBuffer.data.begin() + segmentStartOffset.value(),
+                                pageBuffer.data.begin() + pageOffset
+                            ),
+                            targetControllerConsole
+                        );
+
+                        segmentStartOffset = std::nullopt;
+                    }
+                }
+            }
+
+            this->writePages(completedPageAddresses, targetControllerConsole);
+
+            // Erase whatever remains
+            for (const auto& eraseRange : this->pendingEraseRanges) {
+                this->issueWrite(
+                    eraseRange.startAddress,
+                    TargetMemoryBuffer(eraseRange.endAddress - eraseRange.startAddress + 1, 0xFF),
+                    targetControllerConsole
+                );
+            }
+        }
+
+        this->pageBuffersByAddress.clear();
+        this->pendingEraseRanges.clear();
+
+        this->collectPendingWrites(0);
+
+        if (this->errorMessage.has_value()) {
+            const auto errorMessage = this->errorMessage.value();
+            this->errorMessage = std::nullopt;
+
+            throw Exception(errorMessage);
+        }
+    }
+
+    void FlashWritePipeline::removePendingEraseRange(const TargetMemoryAddressRange& addressRange) {
+        auto remainingRanges = std::set<TargetMemoryAddressRange>();
+
+        for (const auto& pendingRange : this->pendingEraseRanges) {
+            if (
+                pendingRange.endAddress < addressRange.startAddress
+                || pendingRange.startAddress > addressRange.endAddress
+            ) {
+                remainingRanges.insert(pendingRange);
+                continue;
+            }
+
+            // Keep whatever remains of the pending range, either side of the given range
+            if (pendingRange.startAddress < addressRange.startAddress) {
+                remainingRanges.emplace(pendingRange.startAddress, addressRange.startAddress - 1);
+            }
+
+            if (pendingRange.endAddress > addressRange.endAddress) {
+                remainingRanges.emplace(addressRange.endAddress + 1, pendingRange.endAddress);
+            }
+        }
+
+        this->pendingEraseRanges = std::move(remainingRanges);
+    }
+
+    void FlashWritePipeline::writePages(
+        const std::vector<std::uint32_t>& pageAddresses,
+        TargetControllerConsole& targetControllerConsole
+    ) {
+        auto buffer = TargetMemoryBuffer();
+        auto bufferStartAddress = std::uint32_t(0);
+
+        for (const auto pageAddress : pageAddresses) {
+            if (!buffer.empty() && pageAddress != bufferStartAddress + buffer.size()) {
+                this->issueWrite(bufferStartAddress, std::move(buffer), targetControllerConsole);
+                buffer = TargetMemoryBuffer();
+            }
+
+            if (buffer.empty()) {
+                bufferStartAddress = pageAddress;
+            }
+
+            auto pageBufferIt = this->pageBuffersByAddress.find(pageAddress);
+            buffer.insert(buffer.end(), pageBufferIt->second.data.begin(), pageBufferIt->second.data.end());
+            this->pageBuffersByAddress.erase(pageBufferIt);
+        }
+
+        if (!buffer.empty()) {
+            this->issueWrite(bufferStartAddress, std::move(buffer), targetControllerConsole);
+        }
+    }
+
+    void FlashWritePipeline::issueWrite(
+        std::uint32_t startAddress,
+        TargetMemoryBuffer&& buffer,
+        TargetControllerConsole& targetControllerConsole
+    ) {
+        this->collectPendingWrites(FlashWritePipeline::MAX_PENDING_WRITES - 1);
+
+        if (this->errorMessage.has_value()) {
+            return;
+        }
+
+        this->pendingWrites.emplace_back(
+            targetControllerConsole.writeMemoryAsync(this->memoryType, startAddress, buffer)
+        );
+    }
+
+    void FlashWritePipeline::collectPendingWrites(std::size_t maximumPending) {
+        while (
+            !this->pendingWrites.empty()
+            && (this->pendingWrites.size() > maximumPending || this->pendingWrites.front().isReady())
+        ) {
+            try {
+                this->pendingWrites.front().get();
+
+            } catch (const Exception& exception) {
+                Logger::error("Failed to write to flash memory - " + exception.getMessage());
+
+                if (!this->errorMessage.has_value()) {
+                    this->errorMessage = exception.getMessage();
+                }
+            }
+
+            this->pendingWrites.pop_front();
+        }
+    }
+}
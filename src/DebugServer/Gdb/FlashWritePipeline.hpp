@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <deque>
+#include <vector>
+#include <optional>
+#include <string>
+
+#include "src/TargetController/TargetControllerConsole.hpp"
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetDescriptor.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * The FlashWritePipeline services GDB's flash operations ("vFlashErase", "vFlashWrite" and "vFlashDone" packets).
+     *
+     * Data from "vFlashWrite" packets is collected into page-aligned buffers. Once a page has been fully populated,
+     * it's sent to the TargetController via an asynchronous WriteTargetMemory command (consecutive pages completed by
+     * the same packet are sent in a single command). We don't wait for the TargetController to service the write, so
+     * the programming of the target overlaps with the reception of subsequent packets from GDB.
+     *
+     * Erasing is deferred until the flash operation has been completed (via FlashWritePipeline::complete()), at which
+     * point only the regions that haven't been written to are erased. This allows the target to skip the programming
+     * of any unchanged pages (see Avr8TargetConfig::differentialProgramming).
+     *
+     * Any failures are reported upon completion.
+     */
+    class FlashWritePipeline
+    {
+    public:
+        /**
+         * The maximum number of write commands that can be pending with the TargetController at any one time. Once
+         * this limit has been reached, we wait for the oldest to be serviced, before issuing another.
+         */
+        static constexpr std::size_t MAX_PENDING_WRITES = 4;
+
+        /**
+         * The page size to use when the target's program memory descriptor doesn't specify one.
+         */
+        static constexpr std::uint32_t DEFAULT_PAGE_SIZE = 64;
+
+        /**
+         * @param targetDescriptor
+         *  The descriptor of the connected target. The program memory type and page size are taken from this.
+         */
+        explicit FlashWritePipeline(const Targets::TargetDescriptor& targetDescriptor);
+
+        /**
+         * Records a region of flash memory to be erased upon completion.
+         *
+         * @param startAddress
+         * @param bytes
+         */
+        void erase(std::uint32_t startAddress, std::uint32_t bytes);
+
+        /**
+         * Collects data to be written to flash memory, and issues writes for any pages that have been fully
+         * populated.
+         *
+         * This function will not report any write failures - they're reported upon completion.
+         *
+         * @param startAddress
+         * @param buffer
+         * @param targetControllerConsole
+         */
+        void write(
+            std::uint32_t startAddress,
+            const Targets::TargetMemoryBuffer& buffer,
+            TargetController::TargetControllerConsole& targetControllerConsole
+        );
+
+        /**
+         * Writes any partially populated pages, erases any regions that were not written to, and waits for the
+         * TargetController to service all pending writes.
+         *
+         * This function will throw an exception if any of the writes issued by this pipeline have failed.
+         *
+         * @param targetControllerConsole
+         */
+        void complete(TargetController::TargetControllerConsole& targetControllerConsole);
+
+    private:
+        struct PageBuffer
+        {
+            Targets::TargetMemoryBuffer data;
+
+            /**
+             * Which bytes in the page have been populated.
+             */
+            std::vector<bool> populated;
+            std::uint32_t populatedBytes = 0;
+        };
+
+        Targets::TargetMemoryType memoryType;
+        std::uint32_t pageSize = FlashWritePipeline::DEFAULT_PAGE_SIZE;
+
+        /**
+         * Flash address ranges that GDB has asked us to erase, which have not since been written to.
+         */
+        std::set<Targets::TargetMemoryAddressRange> pendingEraseRanges;
+
+        /**
+         * Pages that are yet to be written, mapped by page start address.
+         */
+        std::map<std::uint32_t, PageBuffer> pageBuffersByAddress;
+
+        std::deque<TargetController::PendingResponse<TargetController::Commands::WriteTargetMemory>> pendingWrites;
+
+        /**
+         * The first error encountered in this pipeline. Once set, no further writes will be issued.
+         */
+        std::optional<std::string> errorMessage;
+
+        /**
+         * Removes the given address range from the pending erase ranges.
+         *
+         * @param addressRange
+         */
+        void removePendingEraseRange(const Targets::TargetMemoryAddressRange& addressRange);
+
+        /**
+         * Issues a single write command for each run of consecutive pages in the given page buffers, and removes
+         * the pages from this->pageBuffersByAddress.
+         *
+         * @param pageAddresses
+         * @param targetControllerConsole
+         */
+        void writePages(
+            const std::vector<std::uint32_t>& pageAddresses,
+            TargetController::TargetControllerConsole& targetControllerConsole
+        );
+
+        /**
+         * Issues a write command, without waiting for it to be serviced.
+         *
+         * @param startAddress
+         * @param buffer
+         * @param targetControllerConsole
+         */
+        void issueWrite(
+            std::uint32_t startAddress,
+            Targets::TargetMemoryBuffer&& buffer,
+            TargetController::TargetControllerConsole& targetControllerConsole
+        );
+
+        /**
+         * Collects the outcome of any pending writes that have been serviced by the TargetController.
+         *
+         * @param maximumPending
+         *  The maximum number of writes that can remain pending. If more than this number are pending, we'll wait
+         *  for the oldest to be serviced.
+         */
+        void collectPendingWrites(std::size_t maximumPending);
+    };
+}
@@ -15,5 +15,14 @@ namespace Bloom::DebugServer::Gdb
                 portValue.isString() ? portValue.toString().toInt(nullptr, 10) : portValue.toInt()
             );
         }
+
+        if (debugServerConfig.jsonObject.contains("packetSize")) {
+            const auto packetSizeValue = debugServerConfig.jsonObject.value("packetSize");
+            this->packetSize = static_cast<std::uint32_t>(
+                packetSizeValue.isString()
+                    ? packetSizeValue.toString().toUInt(nullptr, 10)
+                    : packetSizeValue.toInteger()
+            );
+        }
     }
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <optional>
+
 #include "src/ProjectConfig.hpp"
 
 namespace Bloom::DebugServer::Gdb
@@ -24,6 +27,14 @@ namespace Bloom::DebugServer::Gdb
          */
         std::string listeningAddress = "127.0.0.1";
 
+        /**
+         * The maximum packet size to advertise to the GDB client, in bytes.
+         *
+         * This parameter is optional. If not specified, the packet size will be derived from the target's flash page
+         * size. See GdbRspDebugServer::getMaximumPacketSize().
+         */
+        std::optional<std::uint32_t> packetSize;
+
         explicit GdbDebugServerConfig(const DebugServerConfig& debugServerConfig);
     };
 }
@@ -2,6 +2,8 @@
 
 #include <sys/socket.h>
 #include <unistd.h>
+#include <algorithm>
+#include <QString>
 
 #include "src/Logger/Logger.hpp"
 
@@ -30,6 +32,7 @@
 #include "CommandPackets/BloomVersion.hpp"
 #include "CommandPackets/BloomVersionMachine.hpp"
 #include "CommandPackets/TargetInfoMachine.hpp"
+#include "CommandPackets/StartNoAckMode.hpp"
 
 // Response packets
 #include "ResponsePackets/TargetStopped.hpp"
@@ -189,7 +192,7 @@ namespace Bloom::DebugServer::Gdb
             auto commandPacket = this->waitForCommandPacket();
 
             if (commandPacket == nullptr) {
-                // Likely an interrupt
+                // No complete packet has been received yet
                 return;
             }
 
@@ -246,15 +249,14 @@ namespace Bloom::DebugServer::Gdb
     }
 
     std::unique_ptr<CommandPacket> GdbRspDebugServer::waitForCommandPacket() {
-        const auto rawPackets = this->activeDebugSession->connection.readRawPackets();
+        const auto rawPacket = this->activeDebugSession->connection.readRawPacket();
 
-        if (rawPackets.empty()) {
-            // The wait was interrupted
+        if (!rawPacket.has_value()) {
+            // No complete packet was received
             return nullptr;
         }
 
-        // We only process the last packet - any others will probably be duplicates from an impatient client.
-        return this->resolveCommandPacket(rawPackets.back());
+        return this->resolveCommandPacket(rawPacket.value());
     }
 
     std::unique_ptr<CommandPacket> GdbRspDebugServer::resolveCommandPacket(const RawPacketType& rawPacket) {
@@ -274,6 +276,10 @@ namespace Bloom::DebugServer::Gdb
                 return std::make_unique<CommandPackets::SupportedFeaturesQuery>(rawPacket);
             }
 
+            if (rawPacketString.find("QStartNoAckMode") == 1) {
+                return std::make_unique<CommandPackets::StartNoAckMode>(rawPacket);
+            }
+
             if (rawPacketString[1] == 'g' || rawPacketString[1] == 'p') {
                 return std::make_unique<CommandPackets::ReadRegisters>(rawPacket);
             }
@@ -332,9 +338,38 @@ namespace Bloom::DebugServer::Gdb
     std::set<std::pair<Feature, std::optional<std::string>>> GdbRspDebugServer::getSupportedFeatures() {
         return {
             {Feature::SOFTWARE_BREAKPOINTS, std::nullopt},
+            {Feature::NO_ACK_MODE, std::nullopt},
+            {Feature::PACKET_SIZE, QString::number(this->getMaximumPacketSize(), 16).toStdString()},
         };
     }
 
+    std::uint32_t GdbRspDebugServer::getMaximumPacketSize() {
+        if (this->debugServerConfig.packetSize.has_value()) {
+            return std::clamp(
+                this->debugServerConfig.packetSize.value(),
+                GdbRspDebugServer::MINIMUM_PACKET_SIZE,
+                GdbRspDebugServer::MAXIMUM_PACKET_SIZE
+            );
+        }
+
+        const auto& targetDescriptor = this->getGdbTargetDescriptor().targetDescriptor;
+        const auto memoryDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(
+            targetDescriptor.programMemoryType
+        );
+
+        const auto pageSize = (
+            memoryDescriptorIt != targetDescriptor.memoryDescriptorsByType.end()
+            && memoryDescriptorIt->second.pageSize.value_or(0) > 0
+        ) ? memoryDescriptorIt->second.pageSize.value() : GdbRspDebugServer::DEFAULT_PAGE_SIZE;
+
+        // Two characters per byte, for hex-encoded data
+        return std::clamp(
+            (pageSize * GdbRspDebugServer::PAGES_PER_PACKET * 2) + GdbRspDebugServer::PACKET_HEADER_SIZE,
+            GdbRspDebugServer::MINIMUM_PACKET_SIZE,
+            GdbRspDebugServer::MAXIMUM_PACKET_SIZE
+        );
+    }
+
     void GdbRspDebugServer::terminateActiveDebugSession() {
         if (!this->activeDebugSession.has_value()) {
             return;
@@ -356,8 +391,18 @@ namespace Bloom::DebugServer::Gdb
     void GdbRspDebugServer::onTargetExecutionStopped(const Events::TargetExecutionStopped&) {
         try {
             if (this->activeDebugSession.has_value() && this->activeDebugSession->waitingForBreak) {
+                auto expeditedRegisters = std::map<GdbRegisterNumberType, std::vector<unsigned char>>();
+
+                try {
+                    expeditedRegisters = this->readExpeditedRegisters(this->activeDebugSession->gdbTargetDescriptor);
+
+                } catch (const Exception& exception) {
+                    // The client will request the registers itself
+                    Logger::debug("Failed to read expedited registers for stop reply - " + exception.getMessage());
+                }
+
                 this->activeDebugSession->connection.writePacket(
-                    ResponsePackets::TargetStopped(Signal::TRAP)
+                    ResponsePackets::TargetStopped(Signal::TRAP, std::nullopt, expeditedRegisters)
                 );
                 this->activeDebugSession->waitingForBreak = false;
             }
@@ -380,4 +425,69 @@ namespace Bloom::DebugServer::Gdb
             return;
         }
     }
+
+    std::map<GdbRegisterNumberType, std::vector<unsigned char>> GdbRspDebugServer::readExpeditedRegisters(
+        const TargetDescriptor& gdbTargetDescriptor
+    ) {
+        using Targets::TargetRegisterType;
+
+        const auto& registerDescriptorsByType = gdbTargetDescriptor.targetDescriptor.registerDescriptorsByType;
+        const auto& statusRegisterDescriptor = *(
+            registerDescriptorsByType.at(TargetRegisterType::STATUS_REGISTER).begin()
+        );
+
+        auto programCounter = std::uint32_t(0);
+        auto stackPointer = std::uint32_t(0);
+        auto statusRegisters = Targets::TargetRegisters();
+
+        this->targetControllerConsole.batch()
+            .getProgramCounter(programCounter)
+            .getStackPointer(stackPointer)
+            .readRegisters({statusRegisterDescriptor}, statusRegisters)
+            .send();
+
+        auto output = std::map<GdbRegisterNumberType, std::vector<unsigned char>>();
+
+        const auto insertValue = [&output, &gdbTargetDescriptor] (
+            const Targets::TargetRegisterDescriptor& descriptor,
+            std::vector<unsigned char> value
+        ) {
+            const auto registerNumber = gdbTargetDescriptor.getRegisterNumberFromTargetRegisterDescriptor(
+                descriptor
+            );
+
+            if (!registerNumber.has_value()) {
+                return;
+            }
+
+            // Register values are held in MSB form - GDB expects them in LSB form, at the size of the GDB register
+            std::reverse(value.begin(), value.end());
+            value.resize(gdbTargetDescriptor.getRegisterDescriptorFromNumber(registerNumber.value()).size, 0x00);
+            output.insert(std::pair(registerNumber.value(), std::move(value)));
+        };
+
+        const auto toBytes = [] (std::uint32_t value) {
+            return std::vector<unsigned char>({
+                static_cast<unsigned char>(value >> 24),
+                static_cast<unsigned char>(value >> 16),
+                static_cast<unsigned char>(value >> 8),
+                static_cast<unsigned char>(value),
+            });
+        };
+
+        insertValue(
+            *(registerDescriptorsByType.at(TargetRegisterType::PROGRAM_COUNTER).begin()),
+            toBytes(programCounter)
+        );
+        insertValue(
+            *(registerDescriptorsByType.at(TargetRegisterType::STACK_POINTER).begin()),
+            toBytes(stackPointer)
+        );
+
+        for (const auto& statusRegister : statusRegisters) {
+            insertValue(statusRegister.descriptor, statusRegister.value);
+        }
+
+        return output;
+    }
 }
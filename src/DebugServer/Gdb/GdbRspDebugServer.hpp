@@ -4,6 +4,7 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <vector>
+#include <map>
 #include <queue>
 #include <optional>
 
@@ -77,6 +78,25 @@ namespace Bloom::DebugServer::Gdb
         void run() override;
 
     protected:
+        /**
+         * The number of flash pages that the advertised packet size should accommodate (hex-encoded). See
+         * GdbRspDebugServer::getMaximumPacketSize().
+         */
+        static constexpr std::uint32_t PAGES_PER_PACKET = 16;
+
+        /**
+         * The page size to assume when the target's program memory descriptor doesn't specify one.
+         */
+        static constexpr std::uint32_t DEFAULT_PAGE_SIZE = 64;
+
+        /**
+         * Room for the command and arguments that precede the data in a packet (e.g. "M<address>,<length>:").
+         */
+        static constexpr std::uint32_t PACKET_HEADER_SIZE = 64;
+
+        static constexpr std::uint32_t MINIMUM_PACKET_SIZE = 1024;
+        static constexpr std::uint32_t MAXIMUM_PACKET_SIZE = 0x8000;
+
         /**
          * User project configuration specific to the GDB RSP debug server.
          */
@@ -140,9 +160,12 @@ namespace Bloom::DebugServer::Gdb
         std::optional<Connection> waitForConnection();
 
         /**
-         * Waits for a command packet from the connected GDB client.
+         * Returns the next command packet from the connected GDB client, waiting for one if none are pending.
+         *
+         * Every packet received from the client is processed, in the order in which it was received.
          *
          * @return
+         *  The command packet, or a nullptr if the data received from the client didn't complete a packet.
          */
         std::unique_ptr<CommandPackets::CommandPacket> waitForCommandPacket();
 
@@ -176,6 +199,16 @@ namespace Bloom::DebugServer::Gdb
          */
         virtual std::set<std::pair<Feature, std::optional<std::string>>> getSupportedFeatures();
 
+        /**
+         * Determines the maximum packet size to advertise to the GDB client (via the "PacketSize" feature).
+         *
+         * GDB will split any memory reads, writes or flash loads that exceed this size into multiple packets. A
+         * larger packet size means fewer round trips, so we size it to accommodate several flash pages of
+         * hex-encoded data. This can be overridden via the "packetSize" debug server config parameter.
+         *
+         * @return
+         */
+        virtual std::uint32_t getMaximumPacketSize();
 
         /**
          * Terminates any active debug session (if any) by closing the connection to the GDB client.
@@ -205,5 +238,21 @@ namespace Bloom::DebugServer::Gdb
          * a "stop reply" packet to the client once the target execution stops.
          */
         void onTargetExecutionStopped(const Events::TargetExecutionStopped&);
+
+        /**
+         * Reads the program counter, stack pointer and status register, for inclusion in a stop reply packet. The
+         * GDB client needs these registers upon every stop, so we send them in the stop reply, as opposed to waiting
+         * for the client to request them.
+         *
+         * The registers are read via a single CommandBatch.
+         *
+         * @param gdbTargetDescriptor
+         *
+         * @return
+         *  The register values in LSB form, mapped by GDB register number.
+         */
+        std::map<GdbRegisterNumberType, std::vector<unsigned char>> readExpeditedRegisters(
+            const TargetDescriptor& gdbTargetDescriptor
+        );
     };
 }
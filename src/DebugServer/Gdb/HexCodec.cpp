@@ -0,0 +1,52 @@
+#include "HexCodec.hpp"
+
+#include <cstring>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    using Exceptions::Exception;
+
+    void HexCodec::encode(const unsigned char* data, std::size_t length, char* output) {
+        for (std::size_t i = 0; i < length; ++i) {
+            std::memcpy(output + (i * 2), HexCodec::ENCODE_TABLE[data[i]].data(), 2);
+        }
+    }
+
+    void HexCodec::decode(const char* hexData, std::size_t length, unsigned char* output) {
+        if ((length % 2) != 0) {
+            throw Exception("Invalid hex data - odd number of characters");
+        }
+
+        for (std::size_t i = 0; i < (length / 2); ++i) {
+            const auto high = HexCodec::DECODE_TABLE[static_cast<unsigned char>(hexData[i * 2])];
+            const auto low = HexCodec::DECODE_TABLE[static_cast<unsigned char>(hexData[(i * 2) + 1])];
+
+            // Both values will be -1 (all bits set) for non-hexadecimal characters
+            if ((high | low) < 0) {
+                throw Exception("Invalid hex data - unexpected character");
+            }
+
+            output[i] = static_cast<unsigned char>((high << 4) | low);
+        }
+    }
+
+    std::string HexCodec::encode(const std::vector<unsigned char>& data) {
+        auto output = std::string(data.size() * 2, '\0');
+        HexCodec::encode(data.data(), data.size(), output.data());
+        return output;
+    }
+
+    std::string HexCodec::encode(const std::string& data) {
+        auto output = std::string(data.size() * 2, '\0');
+        HexCodec::encode(reinterpret_cast<const unsigned char*>(data.data()), data.size(), output.data());
+        return output;
+    }
+
+    std::vector<unsigned char> HexCodec::decode(const std::string& hexData) {
+        auto output = std::vector<unsigned char>(hexData.size() / 2);
+        HexCodec::decode(hexData.data(), hexData.size(), output.data());
+        return output;
+    }
+}
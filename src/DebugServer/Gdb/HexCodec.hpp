@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * The HexCodec class converts data to and from the hexadecimal form used in GDB RSP packets.
+     *
+     * All memory and register data passes through this codec, so it works from lookup tables, directly into
+     * preallocated buffers. Each byte is encoded via a single table lookup, and decoded via two.
+     */
+    class HexCodec
+    {
+    public:
+        /**
+         * Encodes `length` bytes from `data`, into `output`.
+         *
+         * @param data
+         * @param length
+         *
+         * @param output
+         *  Must have room for (length * 2) characters. No null terminator is written.
+         */
+        static void encode(const unsigned char* data, std::size_t length, char* output);
+
+        /**
+         * Decodes `length` hexadecimal characters from `hexData`, into `output`.
+         *
+         * Both upper and lower case hexadecimal characters are accepted. This function will throw an exception if
+         * `length` is odd, or if `hexData` contains any non-hexadecimal characters.
+         *
+         * @param hexData
+         * @param length
+         *
+         * @param output
+         *  Must have room for (length / 2) bytes.
+         */
+        static void decode(const char* hexData, std::size_t length, unsigned char* output);
+
+        static std::string encode(const std::vector<unsigned char>& data);
+        static std::string encode(const std::string& data);
+
+        static std::vector<unsigned char> decode(const std::string& hexData);
+
+    private:
+        /**
+         * Maps each byte value to its two (lower case) hexadecimal characters.
+         */
+        static constexpr auto ENCODE_TABLE = [] {
+            constexpr auto digits = "0123456789abcdef";
+            auto table = std::array<std::array<char, 2>, 256>();
+
+            for (std::size_t value = 0; value < table.size(); ++value) {
+                table[value] = {digits[value >> 4], digits[value & 0x0F]};
+            }
+
+            return table;
+        }();
+
+        /**
+         * Maps each character to its value as a hexadecimal digit, or -1 for non-hexadecimal characters.
+         */
+        static constexpr auto DECODE_TABLE = [] {
+            auto table = std::array<std::int8_t, 256>();
+            table.fill(-1);
+
+            for (auto character = '0'; character <= '9'; ++character) {
+                table[static_cast<unsigned char>(character)] = static_cast<std::int8_t>(character - '0');
+            }
+
+            for (auto character = 'a'; character <= 'f'; ++character) {
+                table[static_cast<unsigned char>(character)] = static_cast<std::int8_t>(character - 'a' + 10);
+                table[static_cast<unsigned char>(character - 'a' + 'A')] = static_cast<std::int8_t>(
+                    character - 'a' + 10
+                );
+            }
+
+            return table;
+        }();
+    };
+}
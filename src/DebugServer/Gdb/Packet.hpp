@@ -1,11 +1,14 @@
 #pragma once
 
+#include <cstdint>
+#include <array>
 #include <vector>
+#include <string>
 #include <memory>
 #include <numeric>
 #include <QString>
-#include <sstream>
-#include <iomanip>
+
+#include "HexCodec.hpp"
 
 namespace Bloom::DebugServer::Gdb
 {
@@ -46,16 +49,23 @@ namespace Bloom::DebugServer::Gdb
          * @return
          */
         [[nodiscard]] RawPacketType toRawPacket() const {
-            std::vector<unsigned char> packet = {'$'};
             auto data = this->getData();
 
+            // Worst case, every byte is escaped. Plus room for the '$' prefix and the '#' + checksum suffix.
+            auto packet = std::vector<unsigned char>();
+            packet.reserve((data.size() * 2) + 4);
+            packet.push_back('$');
+
             for (const auto& byte : data) {
-                // Escape $ and # characters
+                // Escape $, #, } and * characters (the latter is used for run-length encoding)
                 switch (byte) {
                     case '$':
-                    case '#': {
+                    case '#':
+                    case '}':
+                    case '*': {
                         packet.push_back('}');
                         packet.push_back(byte ^ 0x20);
+                        break;
                     }
                     default: {
                         packet.push_back(byte);
@@ -63,22 +73,16 @@ namespace Bloom::DebugServer::Gdb
                 }
             }
 
-            auto dataSum = std::accumulate(packet.begin() + 1, packet.end(), 0);
-            packet.push_back('#');
-            auto checkSum = QStringLiteral("%1").arg(dataSum % 256, 2, 16, QLatin1Char('0')).toStdString();
-
-            if (checkSum.size() < 2) {
-                packet.push_back('0');
+            const auto checksum = static_cast<unsigned char>(
+                std::accumulate(packet.begin() + 1, packet.end(), std::uint8_t{0})
+            );
 
-                if (checkSum.size() < 1) {
-                    packet.push_back('0');
-                } else {
-                    packet.push_back(static_cast<unsigned char>(checkSum[0]));
-                }
-            }
+            auto checksumHex = std::array<char, 2>();
+            HexCodec::encode(&checksum, 1, checksumHex.data());
 
-            packet.push_back(static_cast<unsigned char>(checkSum[0]));
-            packet.push_back(static_cast<unsigned char>(checkSum[1]));
+            packet.push_back('#');
+            packet.push_back(static_cast<unsigned char>(checksumHex[0]));
+            packet.push_back(static_cast<unsigned char>(checksumHex[1]));
 
             return packet;
         }
@@ -91,32 +95,18 @@ namespace Bloom::DebugServer::Gdb
          * @return
          */
         static std::string toHex(const std::vector<unsigned char>& data) {
-            std::stringstream stream;
-            stream << std::hex << std::setfill('0');
-
-            for (const auto& byte : data) {
-                stream << std::setw(2) << static_cast<unsigned int>(byte);
-            }
-
-            return stream.str();
+            return HexCodec::encode(data);
         }
 
         /**
-         * Converts a string   to hexadecimal form, the form in which responses are expected to be delivered from the
+         * Converts a string to hexadecimal form, the form in which responses are expected to be delivered from the
          * server.
          *
          * @param data
          * @return
          */
         static std::string toHex(const std::string& data) {
-            std::stringstream stream;
-            stream << std::hex << std::setfill('0');
-
-            for (const auto& byte : data) {
-                stream << std::setw(2) << static_cast<unsigned int>(byte);
-            }
-
-            return stream.str();
+            return HexCodec::encode(data);
         }
 
         /**
@@ -126,14 +116,7 @@ namespace Bloom::DebugServer::Gdb
          * @return
          */
         static std::vector<unsigned char> hexToData(const std::string& hexData) {
-            std::vector<unsigned char> output;
-
-            for (auto i = 0; i < hexData.size(); i += 2) {
-                auto hexByte = std::string((hexData.begin() + i), (hexData.begin() + i + 2));
-                output.push_back(static_cast<unsigned char>(std::stoi(hexByte, nullptr, 16)));
-            }
-
-            return output;
+            return HexCodec::decode(hexData);
         }
 
     protected:
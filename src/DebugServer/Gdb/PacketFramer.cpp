@@ -0,0 +1,77 @@
+#include "PacketFramer.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    std::vector<RawPacketType> PacketFramer::feed(const std::vector<unsigned char>& bytes) {
+        auto output = std::vector<RawPacketType>();
+
+        for (const auto byte : bytes) {
+            switch (this->state) {
+                case State::IDLE: {
+                    if (byte == 0x03) {
+                        /*
+                         * This is an interrupt packet - it doesn't carry any of the usual packet frame bytes, so
+                         * we'll just add them here, in order to keep things consistent.
+                         *
+                         * Because we're effectively faking the packet frame, we can use any value for the checksum.
+                         */
+                        output.push_back({'$', byte, '#', 'F', 'F'});
+                        break;
+                    }
+
+                    if (byte == '$') {
+                        // Beginning of packet
+                        this->packet = {'$'};
+                        this->byteEscaped = false;
+                        this->state = State::DATA;
+                    }
+
+                    // Anything else between packets (such as acknowledgements) is of no interest to us
+                    break;
+                }
+                case State::DATA: {
+                    if (this->byteEscaped) {
+                        // Escaped bytes are XOR'd with a 0x20 mask.
+                        this->packet.push_back(byte ^ 0x20);
+                        this->byteEscaped = false;
+                        break;
+                    }
+
+                    if (byte == '}') {
+                        this->byteEscaped = true;
+                        break;
+                    }
+
+                    if (byte == '$') {
+                        // Unexpected beginning of another packet - discard the incomplete one
+                        this->packet = {'$'};
+                        break;
+                    }
+
+                    this->packet.push_back(byte);
+
+                    if (byte == '#') {
+                        // End of packet data
+                        this->checksumBytesRead = 0;
+                        this->state = State::CHECKSUM;
+                    }
+
+                    break;
+                }
+                case State::CHECKSUM: {
+                    this->packet.push_back(byte);
+
+                    if (++this->checksumBytesRead == 2) {
+                        output.emplace_back(std::move(this->packet));
+                        this->packet = {};
+                        this->state = State::IDLE;
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        return output;
+    }
+}
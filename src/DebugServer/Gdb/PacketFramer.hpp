@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "src/DebugServer/Gdb/Packet.hpp"
+
+namespace Bloom::DebugServer::Gdb
+{
+    /**
+     * The PacketFramer extracts GDB RSP packets from the stream of bytes received from the client.
+     *
+     * The framer is stateful - a packet can span any number of reads from the client's socket. Bytes belonging to an
+     * incomplete packet are retained until the remainder of the packet arrives, so there is no limit on packet size.
+     *
+     * Extracted packets take the same form as they did on the wire ('$' + data + '#' + two checksum characters),
+     * except that any escaped bytes in the packet data will have been unescaped.
+     */
+    class PacketFramer
+    {
+    public:
+        /**
+         * Processes bytes received from the client.
+         *
+         * Interrupt requests (a single 0x03 byte, outside of any packet) are returned as a packet with a data
+         * field of 0x03 - see CommandPackets::InterruptExecution.
+         *
+         * @param bytes
+         *
+         * @return
+         *  All packets completed by the given bytes, in the order in which they were received.
+         */
+        std::vector<RawPacketType> feed(const std::vector<unsigned char>& bytes);
+
+    private:
+        enum class State: std::uint8_t
+        {
+            IDLE,
+            DATA,
+            CHECKSUM,
+        };
+
+        State state = State::IDLE;
+
+        /**
+         * The packet currently being framed.
+         */
+        RawPacketType packet;
+
+        bool byteEscaped = false;
+        std::uint8_t checksumBytesRead = 0;
+    };
+}
@@ -1,15 +1,23 @@
 #pragma once
 
+#include <map>
+#include <vector>
+
 #include "ResponsePacket.hpp"
 
 #include "src/DebugServer/Gdb/Signal.hpp"
 #include "src/DebugServer/Gdb/StopReason.hpp"
+#include "src/DebugServer/Gdb/RegisterDescriptor.hpp"
 
 namespace Bloom::DebugServer::Gdb::ResponsePackets
 {
     /**
      * The TargetStopped class implements the response packet structure for any commands that expect a "StopReply"
      * packet in response.
+     *
+     * The stop reply can carry the values of some registers (expedited registers), sparing the GDB client from
+     * having to request them separately. Register values are expected in the target's byte order (LSB first, for
+     * AVR targets).
      */
     class TargetStopped: public ResponsePacket
     {
@@ -17,12 +25,21 @@ namespace Bloom::DebugServer::Gdb::ResponsePackets
         Signal signal;
         std::optional<StopReason> stopReason;
 
-        explicit TargetStopped(Signal signal, const std::optional<StopReason>& stopReason = std::nullopt)
+        explicit TargetStopped(
+            Signal signal,
+            const std::optional<StopReason>& stopReason = std::nullopt,
+            const std::map<GdbRegisterNumberType, std::vector<unsigned char>>& expeditedRegisters = {}
+        )
             : signal(signal)
             , stopReason(stopReason)
         {
             std::string packetData = "T" + Packet::toHex(std::vector({static_cast<unsigned char>(this->signal)}));
 
+            for (const auto& [registerNumber, value] : expeditedRegisters) {
+                packetData += QString::number(registerNumber, 16).rightJustified(2, '0').toStdString() + ":"
+                    + Packet::toHex(value) + ";";
+            }
+
             if (this->stopReason.has_value()) {
                 static const auto stopReasonMapping = getStopReasonToNameMapping();
                 const auto stopReasonName = stopReasonMapping.valueAt(this->stopReason.value());
@@ -11,3 +11,4 @@
 #include "src/DebugToolDrivers/Microchip/XplainedNano/XplainedNano.hpp"
 #include "src/DebugToolDrivers/Microchip/CuriosityNano/CuriosityNano.hpp"
 #include "src/DebugToolDrivers/Microchip/JtagIce3/JtagIce3.hpp"
+#include "src/DebugToolDrivers/Simulator/Simulator.hpp"
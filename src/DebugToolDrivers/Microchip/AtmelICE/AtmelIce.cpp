@@ -19,6 +19,11 @@ namespace Bloom::DebugToolDrivers
         usbHidInterface.setVendorId(this->vendorId);
         usbHidInterface.setProductId(this->productId);
 
+        if (this->toolConfig.asyncHidTransfers) {
+            usbHidInterface.setLibUsbContext(this->libUsbContext);
+            usbHidInterface.setAsyncTransfersEnabled(true);
+        }
+
         if (!usbHidInterface.isInitialised()) {
             usbHidInterface.detachKernelDriver();
             this->setConfiguration(0);
@@ -33,7 +38,10 @@ namespace Bloom::DebugToolDrivers
          */
         this->getEdbgInterface().setMinimumCommandTimeGap(std::chrono::milliseconds(35));
 
-        // We don't need to claim the CMSISDAP interface here as the HIDAPI will have already done so.
+        if (this->toolConfig.pipelineAvrCommands) {
+            this->getEdbgInterface().setMaximumPendingCommands(4);
+        }
+
         if (!this->sessionStarted) {
             this->startSession();
         }
@@ -13,18 +13,13 @@ namespace Bloom::DebugToolDrivers
     void CuriosityNano::init() {
         UsbDevice::init();
 
-        // TODO: Move away from hard-coding the CMSIS-DAP/EDBG interface number
-        auto& usbHidInterface = this->getEdbgInterface().getUsbHidInterface();
-        usbHidInterface.setNumber(0);
-        usbHidInterface.setLibUsbDevice(this->libUsbDevice);
-        usbHidInterface.setLibUsbDeviceHandle(this->libUsbDeviceHandle);
-        usbHidInterface.setVendorId(this->vendorId);
-        usbHidInterface.setProductId(this->productId);
-
-        if (!usbHidInterface.isInitialised()) {
-            usbHidInterface.detachKernelDriver();
-            usbHidInterface.init();
-        }
+        this->getEdbgInterface().initUsbInterface(
+            this->libUsbDevice,
+            this->libUsbDeviceHandle,
+            this->vendorId,
+            this->productId,
+            true
+        );
 
         this->getEdbgInterface().setMinimumCommandTimeGap(std::chrono::milliseconds(35));
 
@@ -47,7 +42,8 @@ namespace Bloom::DebugToolDrivers
             this->endSession();
         }
 
-        this->getEdbgInterface().getUsbHidInterface().close();
+        this->getEdbgInterface().closeUsbInterface();
+
         UsbDevice::close();
     }
 
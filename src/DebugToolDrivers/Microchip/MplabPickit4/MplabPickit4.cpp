@@ -11,21 +11,16 @@ namespace Bloom::DebugToolDrivers
     void MplabPickit4::init() {
         UsbDevice::init();
 
-        // TODO: Move away from hard-coding the CMSIS-DAP/EDBG interface number
-        auto& usbHidInterface = this->getEdbgInterface().getUsbHidInterface();
-        usbHidInterface.setNumber(0);
-        usbHidInterface.setLibUsbDevice(this->libUsbDevice);
-        usbHidInterface.setLibUsbDeviceHandle(this->libUsbDeviceHandle);
-        usbHidInterface.setVendorId(this->vendorId);
-        usbHidInterface.setProductId(this->productId);
-
-        if (!usbHidInterface.isInitialised()) {
-            usbHidInterface.init();
-        }
+        this->getEdbgInterface().initUsbInterface(
+            this->libUsbDevice,
+            this->libUsbDeviceHandle,
+            this->vendorId,
+            this->productId,
+            false
+        );
 
         this->getEdbgInterface().setMinimumCommandTimeGap(std::chrono::milliseconds(35));
 
-        // We don't need to claim the CMSISDAP interface here as the HIDAPI will have already done so.
         if (!this->sessionStarted) {
             this->startSession();
         }
@@ -41,7 +36,8 @@ namespace Bloom::DebugToolDrivers
             this->endSession();
         }
 
-        this->getEdbgInterface().getUsbHidInterface().close();
+        this->getEdbgInterface().closeUsbInterface();
+
         UsbDevice::close();
     }
 
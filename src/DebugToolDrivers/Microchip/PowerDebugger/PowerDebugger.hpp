@@ -9,6 +9,7 @@
 #include "src/DebugToolDrivers/USB/HID/HidInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/CmsisDapInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/EdbgInterface.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/EdbgDebugToolConfig.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/EdbgAvr8Interface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/EdbgAvrIspInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AvrCommandFrames.hpp"
@@ -32,7 +33,10 @@ namespace Bloom::DebugToolDrivers
         static const std::uint16_t USB_VENDOR_ID = 1003;
         static const std::uint16_t USB_PRODUCT_ID = 8516;
 
-        PowerDebugger(): UsbDevice(PowerDebugger::USB_VENDOR_ID, PowerDebugger::USB_PRODUCT_ID) {}
+        explicit PowerDebugger(const DebugToolConfig& debugToolConfig)
+            : UsbDevice(PowerDebugger::USB_VENDOR_ID, PowerDebugger::USB_PRODUCT_ID)
+            , toolConfig(debugToolConfig)
+        {}
 
         void init() override;
 
@@ -72,6 +76,8 @@ namespace Bloom::DebugToolDrivers
         void endSession();
 
     private:
+        Protocols::CmsisDap::Edbg::EdbgDebugToolConfig toolConfig;
+
         /**
          * The EDBG interface implements additional functionality via vendor specific CMSIS-DAP commands.
          * In other words, all EDBG commands are just CMSIS-DAP vendor commands that allow the debug tool
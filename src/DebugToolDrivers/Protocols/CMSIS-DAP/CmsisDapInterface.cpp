@@ -1,14 +1,135 @@
 #include "CmsisDapInterface.hpp"
 
 #include <thread>
+#include <algorithm>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
+#include "src/Logger/Logger.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
 {
     using namespace Bloom::Exceptions;
 
+    void CmsisDapInterface::initUsbInterface(
+        libusb_device* libUsbDevice,
+        libusb_device_handle* libUsbDeviceHandle,
+        std::uint16_t vendorId,
+        std::uint16_t productId,
+        bool detachHidKernelDriver
+    ) {
+        const auto bulkInterfaceNumber = Usb::BulkInterface::findCmsisDapInterfaceNumber(
+            libUsbDevice,
+            libUsbDeviceHandle
+        );
+
+        if (bulkInterfaceNumber.has_value()) {
+            this->usbBulkInterface.setNumber(bulkInterfaceNumber.value());
+            this->usbBulkInterface.setLibUsbDevice(libUsbDevice);
+            this->usbBulkInterface.setLibUsbDeviceHandle(libUsbDeviceHandle);
+            this->usbBulkInterface.setVendorId(vendorId);
+            this->usbBulkInterface.setProductId(productId);
+
+            if (!this->usbBulkInterface.isInitialised()) {
+                this->usbBulkInterface.init();
+            }
+
+            this->setBulkTransportEnabled(true);
+
+            /*
+             * The endpoint packet size is 64 bytes for full-speed devices, but a single CMSIS-DAP packet can span
+             * several USB packets. The debug tool tells us how large a CMSIS-DAP packet can be.
+             */
+            const auto packetSize = this->queryPacketSize();
+            if (packetSize.has_value() && packetSize.value() > 0) {
+                this->usbBulkInterface.setMaximumTransferSize(packetSize.value());
+            }
+
+            Logger::debug(
+                "Using CMSIS-DAP v2 bulk transport - packet size: "
+                    + std::to_string(this->usbBulkInterface.getMaximumTransferSize())
+            );
+            return;
+        }
+
+        // TODO: Move away from hard-coding the CMSIS-DAP/EDBG interface number
+        this->usbHidInterface.setNumber(0);
+        this->usbHidInterface.setLibUsbDevice(libUsbDevice);
+        this->usbHidInterface.setLibUsbDeviceHandle(libUsbDeviceHandle);
+        this->usbHidInterface.setVendorId(vendorId);
+        this->usbHidInterface.setProductId(productId);
+
+        if (!this->usbHidInterface.isInitialised()) {
+            if (detachHidKernelDriver) {
+                this->usbHidInterface.detachKernelDriver();
+            }
+
+            this->usbHidInterface.init();
+        }
+    }
+
+    void CmsisDapInterface::closeUsbInterface() {
+        if (this->bulkTransportEnabled) {
+            this->usbBulkInterface.close();
+            return;
+        }
+
+        this->usbHidInterface.close();
+    }
+
+    std::optional<std::uint16_t> CmsisDapInterface::queryPacketSize() {
+        // DAP_Info command (0x00), with the "packet size" info ID (0xFF)
+        auto infoCommand = Command(0x00);
+        infoCommand.setData({0xFF});
+
+        const auto response = this->sendCommandAndWaitForResponse(infoCommand);
+        const auto& responseData = response.getData();
+
+        // The response data consists of the length of the info (2 bytes for the packet size), followed by the info
+        if (responseData.size() < 3 || responseData[0] != 2) {
+            return std::nullopt;
+        }
+
+        return static_cast<std::uint16_t>(responseData[1] | (responseData[2] << 8));
+    }
+
     void CmsisDapInterface::sendCommand(const Command& cmsisDapCommand) {
+        this->enforceMinimumCommandTimeGap();
+        this->writePacket(static_cast<std::vector<unsigned char>>(cmsisDapCommand));
+    }
+
+    unsigned char* CmsisDapInterface::getCommandPacketBuffer() {
+        const auto packetSize = this->getPacketSize();
+
+        if (this->commandPacketBuffer.size() != packetSize) {
+            this->commandPacketBuffer.resize(packetSize);
+        }
+
+        return this->commandPacketBuffer.data();
+    }
+
+    void CmsisDapInterface::sendCommandPacket(std::size_t length, bool enforceTimeGap) {
+        if (length > this->commandPacketBuffer.size()) {
+            throw DeviceCommunicationFailure("Cannot send CMSIS-DAP command - command exceeds packet size.");
+        }
+
+        if (enforceTimeGap) {
+            this->enforceMinimumCommandTimeGap();
+        }
+
+        if (this->bulkTransportEnabled) {
+            this->usbBulkInterface.write(this->commandPacketBuffer.data(), length);
+            return;
+        }
+
+        /*
+         * The buffer is already report-sized, so we just clear whatever follows the command, and send the whole
+         * buffer as the report. This saves the HID interface from having to pad the report in its own buffer.
+         */
+        std::fill(this->commandPacketBuffer.begin() + static_cast<long>(length), this->commandPacketBuffer.end(), 0);
+        this->usbHidInterface.write(this->commandPacketBuffer.data(), this->commandPacketBuffer.size());
+    }
+
+    void CmsisDapInterface::enforceMinimumCommandTimeGap() {
         if (this->msSendCommandDelay.count() > 0) {
             using namespace std::chrono;
             std::int64_t now = duration_cast<milliseconds>(high_resolution_clock::now().time_since_epoch()).count();
@@ -16,11 +137,27 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
 
             if (difference < this->msSendCommandDelay.count()) {
                 std::this_thread::sleep_for(milliseconds(this->msSendCommandDelay.count() - difference));
+                now += this->msSendCommandDelay.count() - difference;
             }
 
             this->lastCommandSentTimeStamp = now;
         }
+    }
+
+    std::vector<unsigned char> CmsisDapInterface::readPacket(unsigned int timeout, bool singleReport) {
+        if (this->bulkTransportEnabled) {
+            return this->usbBulkInterface.read(timeout);
+        }
+
+        return singleReport ? this->usbHidInterface.readReport(timeout) : this->usbHidInterface.read(timeout);
+    }
+
+    void CmsisDapInterface::writePacket(std::vector<unsigned char>&& packet) {
+        if (this->bulkTransportEnabled) {
+            this->usbBulkInterface.write(packet);
+            return;
+        }
 
-        this->getUsbHidInterface().write(static_cast<std::vector<unsigned char>>(cmsisDapCommand));
+        this->usbHidInterface.write(std::move(packet));
     }
 }
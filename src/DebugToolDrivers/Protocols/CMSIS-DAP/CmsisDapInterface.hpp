@@ -3,11 +3,12 @@
 #include <memory>
 #include <chrono>
 #include <cstdint>
+#include <optional>
 
 #include "src/DebugToolDrivers/USB/HID/HidInterface.hpp"
+#include "src/DebugToolDrivers/USB/Bulk/BulkInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Response.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
-#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrCommand.hpp"
 
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
 
@@ -17,6 +18,9 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
      * The CmsisDapInterface class implements the CMSIS-DAP protocol.
      *
      * See https://www.keil.com/support/man/docs/dapdebug/dapdebug_introduction.htm for more on the CMSIS-DAP protocol.
+     *
+     * Commands and responses are transferred via USB HID reports (CMSIS-DAP v1), by default. Debug tools that expose
+     * a CMSIS-DAP v2 interface can use its bulk endpoints instead - see CmsisDapInterface::setBulkTransportEnabled().
      */
     class CmsisDapInterface
     {
@@ -38,6 +42,76 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
             return this->usbHidInterface.getInputReportSize();
         }
 
+        Usb::BulkInterface& getUsbBulkInterface() {
+            return this->usbBulkInterface;
+        }
+
+        /**
+         * Initialises the USB interface used for CMSIS-DAP communication.
+         *
+         * Newer firmware revisions of some debug tools expose a CMSIS-DAP v2 interface, with bulk endpoints. Where
+         * available, we use that in place of the HID interface, as it isn't bound to fixed-size reports. The packet
+         * size of the bulk transport is obtained from the debug tool (see CmsisDapInterface::queryPacketSize()).
+         *
+         * Otherwise, we fall back to the HID interface (interface number 0).
+         *
+         * @param libUsbDevice
+         * @param libUsbDeviceHandle
+         * @param vendorId
+         * @param productId
+         *
+         * @param detachHidKernelDriver
+         *  Whether the kernel driver should be detached from the HID interface, before it's initialised.
+         */
+        void initUsbInterface(
+            libusb_device* libUsbDevice,
+            libusb_device_handle* libUsbDeviceHandle,
+            std::uint16_t vendorId,
+            std::uint16_t productId,
+            bool detachHidKernelDriver
+        );
+
+        /**
+         * Closes the USB interface initialised via CmsisDapInterface::initUsbInterface().
+         */
+        void closeUsbInterface();
+
+        /**
+         * Selects the CMSIS-DAP v2 bulk transport. The bulk interface must be initialised prior to this. See
+         * CmsisDapInterface::initUsbInterface().
+         *
+         * Bulk transfers are not padded to a fixed report size, and the packet size is typically larger than that of
+         * the HID reports (512 bytes, for high-speed devices).
+         *
+         * @param enabled
+         */
+        void setBulkTransportEnabled(bool enabled) {
+            this->bulkTransportEnabled = enabled;
+        }
+
+        [[nodiscard]] bool isBulkTransportEnabled() const {
+            return this->bulkTransportEnabled;
+        }
+
+        /**
+         * The maximum size of a single command or response packet, for the selected transport.
+         *
+         * @return
+         */
+        std::size_t getPacketSize() {
+            return this->bulkTransportEnabled
+                ? this->usbBulkInterface.getMaximumTransferSize()
+                : this->usbHidInterface.getInputReportSize();
+        }
+
+        /**
+         * Queries the debug tool's maximum packet size, via the CMSIS-DAP DAP_Info command.
+         *
+         * @return
+         *  The packet size, or std::nullopt if the debug tool didn't report one.
+         */
+        std::optional<std::uint16_t> queryPacketSize();
+
         void setMinimumCommandTimeGap(std::chrono::milliseconds commandTimeGap) {
             this->msSendCommandDelay = commandTimeGap;
         }
@@ -56,7 +130,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
          *
          * @return
          *  An instance to ResponseType, which must be derived from the Response class. The instance is constructed via
-         *  its raw buffer constructor: ResponseType(const std::vector<unsigned char>&).
+         *  its raw buffer constructor. The raw buffer is moved into the constructor, so response types that take
+         *  the buffer by value can adopt it without copying.
          */
         template<class ResponseType>
         auto getResponse() {
@@ -65,13 +140,13 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
                 "CMSIS Response type must be derived from the Response class."
             );
 
-            const auto rawResponse = this->getUsbHidInterface().read(15000);
+            auto rawResponse = this->readPacket(15000, false);
 
             if (rawResponse.empty()) {
                 throw Exceptions::DeviceCommunicationFailure("Empty CMSIS-DAP response received");
             }
 
-            return ResponseType(rawResponse);
+            return ResponseType(std::move(rawResponse));
         }
 
         /**
@@ -105,6 +180,68 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
             return response;
         }
 
+    protected:
+        /**
+         * Listens for a single-report CMSIS-DAP response from the device.
+         *
+         * This must be used in place of CmsisDapInterface::getResponse() when more than one response is pending, as
+         * CmsisDapInterface::getResponse() would consume any following reports as part of the same response.
+         *
+         * @return
+         *  See CmsisDapInterface::getResponse().
+         */
+        template<class ResponseType>
+        auto getPipelinedResponse() {
+            static_assert(
+                std::is_base_of<Response, ResponseType>::value,
+                "CMSIS Response type must be derived from the Response class."
+            );
+
+            auto rawResponse = this->readPacket(15000, true);
+
+            if (rawResponse.empty()) {
+                throw Exceptions::DeviceCommunicationFailure("Empty CMSIS-DAP response received");
+            }
+
+            return ResponseType(std::move(rawResponse));
+        }
+
+        /**
+         * Sends a CMSIS-DAP command to the device, without enforcing the minimum time gap between commands.
+         *
+         * This should only be used for commands that follow on from a command sent via
+         * CmsisDapInterface::sendCommand(), as part of the same exchange (for example, the remaining fragments of a
+         * multi-fragment EDBG AVR command).
+         *
+         * @param cmsisDapCommand
+         */
+        void sendCommandWithoutTimeGap(const Command& cmsisDapCommand) {
+            this->writePacket(static_cast<std::vector<unsigned char>>(cmsisDapCommand));
+        }
+
+        /**
+         * Returns the command packet buffer - a reusable buffer, sized to the packet size of the selected transport.
+         *
+         * Commands can be serialised directly into this buffer, and then sent via
+         * CmsisDapInterface::sendCommandPacket(), avoiding the construction of a Command object and its buffers.
+         *
+         * The buffer is only (re)allocated when the packet size changes. Its contents are not preserved between
+         * sends.
+         *
+         * @return
+         */
+        unsigned char* getCommandPacketBuffer();
+
+        /**
+         * Sends the first `length` bytes of the command packet buffer to the device, as a single CMSIS-DAP command.
+         *
+         * @param length
+         * @param enforceTimeGap
+         *  Whether to enforce the minimum time gap between commands. See
+         *  CmsisDapInterface::sendCommandWithoutTimeGap() for when this can be skipped.
+         */
+        void sendCommandPacket(std::size_t length, bool enforceTimeGap = true);
+
     private:
         /**
          * All CMSIS-DAP devices employ the USB HID interface for communication.
@@ -115,6 +252,12 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
          */
         Usb::HidInterface usbHidInterface = Usb::HidInterface();
 
+        /**
+         * Only used when the bulk transport has been selected. See CmsisDapInterface::setBulkTransportEnabled().
+         */
+        Usb::BulkInterface usbBulkInterface = Usb::BulkInterface();
+        bool bulkTransportEnabled = false;
+
         /**
          * Some CMSIS-DAP debug tools fail to operate properly when we send commands too quickly. Even if we've
          * received a response from every previous command.
@@ -125,5 +268,33 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
          */
         std::chrono::milliseconds msSendCommandDelay = std::chrono::milliseconds(0);
         std::int64_t lastCommandSentTimeStamp = 0;
+
+        /**
+         * See CmsisDapInterface::getCommandPacketBuffer().
+         */
+        std::vector<unsigned char> commandPacketBuffer;
+
+        /**
+         * Sleeps for whatever remains of the minimum time gap since the last command was sent.
+         */
+        void enforceMinimumCommandTimeGap();
+
+        /**
+         * Reads a single packet from the selected transport.
+         *
+         * @param timeout
+         * @param singleReport
+         *  Only applicable to the HID transport. See HidInterface::readReport().
+         *
+         * @return
+         */
+        std::vector<unsigned char> readPacket(unsigned int timeout, bool singleReport);
+
+        /**
+         * Writes a single packet to the selected transport. HID reports are padded to the report size.
+         *
+         * @param packet
+         */
+        void writePacket(std::vector<unsigned char>&& packet);
     };
 }
@@ -4,12 +4,15 @@
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
 {
-    Response::Response(const std::vector<unsigned char>& rawResponse) {
+    Response::Response(std::vector<unsigned char> rawResponse) {
         if (rawResponse.empty()) {
             throw Exceptions::Exception("Failed to process CMSIS-DAP response - invalid response");
         }
 
         this->setResponseId(rawResponse[0]);
-        this->setData(std::vector<unsigned char>(rawResponse.begin() + 1, rawResponse.end()));
+
+        // Drop the response ID in place, and take ownership of the buffer
+        rawResponse.erase(rawResponse.begin());
+        this->data = std::move(rawResponse);
     }
 }
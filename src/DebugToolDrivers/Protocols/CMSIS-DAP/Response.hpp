@@ -7,7 +7,13 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap
     class Response
     {
     public:
-        Response(const std::vector<unsigned char>& rawResponse);
+        /**
+         * The raw response buffer is taken by value, so that it can be adopted (moved) as the response data, without
+         * being copied.
+         *
+         * @param rawResponse
+         */
+        Response(std::vector<unsigned char> rawResponse);
         virtual ~Response() = default;
 
         Response(const Response& other) = default;
@@ -188,5 +188,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         APPLICATION_SECTION = 0x01,
         BOOT_SECTION = 0x02,
         EEPROM = 0x03,
+        APPLICATION_PAGE = 0x04,
+        BOOT_PAGE = 0x05,
     };
 }
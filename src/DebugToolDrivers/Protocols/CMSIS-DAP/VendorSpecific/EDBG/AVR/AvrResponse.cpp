@@ -6,7 +6,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
 {
     using namespace Bloom::Exceptions;
 
-    AvrResponse::AvrResponse(const std::vector<unsigned char>& rawResponse): Response(rawResponse) {
+    AvrResponse::AvrResponse(std::vector<unsigned char> rawResponse): Response(std::move(rawResponse)) {
         if (this->getResponseId() != 0x81) {
             throw Exception("Failed to construct AvrResponse object - invalid response ID.");
         }
@@ -27,15 +27,17 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         this->setFragmentCount(static_cast<std::uint8_t>(responseData[0] & 0x0FU));
         this->setFragmentNumber(static_cast<std::uint8_t>(responseData[0] >> 4));
 
+        if (responseData.size() < 3) {
+            throw Exception("Failed to construct AvrResponse object - AVR_RSP response is missing size bytes");
+        }
+
         // Response size is two bytes, MSB
         const auto responsePacketSize = static_cast<std::size_t>((responseData[1] << 8U) + responseData[2]);
-        std::vector<unsigned char> responsePacket;
-        responsePacket.resize(responsePacketSize);
 
-        for (std::size_t i = 0; i < responsePacketSize; i++) {
-            responsePacket[i] = responseData[i + 3];
+        if (responseData.size() < 3 + responsePacketSize) {
+            throw Exception("Failed to construct AvrResponse object - AVR_RSP response contains invalid size");
         }
 
-        this->setResponsePacket(responsePacket);
+        this->responsePacketSize = responsePacketSize;
     }
 }
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <vector>
+#include <span>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Response.hpp"
 
@@ -10,7 +11,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     class AvrResponse: public Response
     {
     public:
-        explicit AvrResponse(const std::vector<unsigned char>& rawResponse);
+        explicit AvrResponse(std::vector<unsigned char> rawResponse);
 
         [[nodiscard]] std::uint8_t getFragmentNumber() const {
             return this->fragmentNumber;
@@ -20,8 +21,17 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             return this->fragmentCount;
         }
 
-        [[nodiscard]] const std::vector<unsigned char>& getResponsePacket() const {
-            return this->responsePacket;
+        /**
+         * The response packet is not copied out of the raw response - this returns a view over the response data.
+         *
+         * @return
+         */
+        [[nodiscard]] std::span<const unsigned char> getResponsePacket() const {
+            if (this->responsePacketSize == 0) {
+                return {};
+            }
+
+            return std::span<const unsigned char>(this->getData()).subspan(3, this->responsePacketSize);
         }
 
     protected:
@@ -33,14 +43,14 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             this->fragmentCount = fragmentCount;
         }
 
-        void setResponsePacket(const std::vector<unsigned char>& responsePacket) {
-            this->responsePacket = responsePacket;
-        }
-
     private:
         std::uint8_t fragmentNumber = 0;
         std::uint8_t fragmentCount = 0;
 
-        std::vector<unsigned char> responsePacket;
+        /**
+         * The response packet occupies the response data, from the fourth byte (following the fragment info and
+         * size bytes).
+         */
+        std::size_t responsePacketSize = 0;
     };
 }
@@ -9,22 +9,22 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
     class EraseMemory: public Avr8GenericCommandFrame<std::array<unsigned char, 7>>
     {
     public:
-        EraseMemory(Avr8EraseMemoryMode mode) {
+        explicit EraseMemory(Avr8EraseMemoryMode mode, std::uint32_t startAddress = 0x00000000) {
             /*
              * The erase memory command consists of 7 bytes:
              * 1. Command ID (0x20)
              * 2. Version (0x00)
              * 3. Erase mode (see Avr8EraseMemoryMode enum)
-             * 4. Start address (4 bytes) - this is just hardcoded to 0x00000000 for now.
+             * 4. Start address (4 bytes) - only used for page erase modes.
              */
             this->payload = {
                 0x20,
                 0x00,
                 static_cast<unsigned char>(mode),
-                0x00,
-                0x00,
-                0x00,
-                0x00,
+                static_cast<unsigned char>(startAddress),
+                static_cast<unsigned char>(startAddress >> 8),
+                static_cast<unsigned char>(startAddress >> 16),
+                static_cast<unsigned char>(startAddress >> 24),
             };
         }
     };
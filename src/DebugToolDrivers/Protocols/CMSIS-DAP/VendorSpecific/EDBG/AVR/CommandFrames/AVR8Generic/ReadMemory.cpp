@@ -1,7 +1,6 @@
 #include "ReadMemory.hpp"
 
-#include <bitset>
-#include <cmath>
+#include <algorithm>
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::Avr8Generic
 {
@@ -9,7 +8,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
         const Avr8MemoryType& type,
         std::uint32_t address,
         std::uint32_t bytes,
-        const std::set<std::uint32_t>& excludedAddresses
+        const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
     ) {
         /*
          * The read memory command consists of 11 + (bytes / 8) bytes:
@@ -21,7 +20,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
          * 6. Mask to apply (bytes / 8) - only required if we're using the masked read command (command ID 0x22).
          */
         this->payload = std::vector<unsigned char>(11, 0x00);
-        this->payload[0] = excludedAddresses.empty() ? 0x21 : 0x22;
+        this->payload[0] = excludedAddressRanges.empty() ? 0x21 : 0x22;
         this->payload[1] = 0x00;
         this->payload[2] = static_cast<unsigned char>(type);
         this->payload[3] = static_cast<unsigned char>(address);
@@ -33,26 +32,43 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
         this->payload[9] = static_cast<unsigned char>(bytes >> 16);
         this->payload[10] = static_cast<unsigned char>(bytes >> 24);
 
-        if (!excludedAddresses.empty()) {
+        if (!excludedAddressRanges.empty() && bytes > 0) {
+            /*
+             * Each bit in the mask corresponds to a single byte in the read (LSB first) - a set bit means the byte
+             * should be read.
+             *
+             * We start with every byte included, and clear the bits for each excluded range, one mask byte at a time
+             * where possible.
+             */
             const auto endAddress = address + (bytes - 1);
+            const auto maskStartIndex = this->payload.size();
 
-            constexpr auto byteBitSize = std::numeric_limits<unsigned char>::digits;
-            auto byteBitset = std::bitset<byteBitSize>();
-            byteBitset.reset();
+            this->payload.resize(maskStartIndex + ((bytes + 7) / 8), 0xFF);
 
-            for (std::uint32_t address = address; address <= endAddress; address++) {
-                auto addressIndex = address - address;
-                auto bitIndex = static_cast<std::size_t>(
-                    addressIndex - (std::floor(addressIndex / byteBitSize) * byteBitSize)
-                );
+            if (bytes % 8 != 0) {
+                // Clear the bits beyond the end of the read
+                this->payload.back() = static_cast<unsigned char>((0x01 << (bytes % 8)) - 1);
+            }
 
-                if (!excludedAddresses.contains(address)) {
-                    byteBitset[bitIndex] = true;
+            for (const auto& excludedRange : excludedAddressRanges) {
+                if (excludedRange.startAddress > endAddress || excludedRange.endAddress < address) {
+                    continue;
                 }
 
-                if (address > 0 && (bitIndex == 7 || address == endAddress)) {
-                    this->payload.emplace_back(byteBitset.to_ulong());
-                    byteBitset.reset();
+                auto index = std::max(excludedRange.startAddress, address) - address;
+                const auto lastIndex = std::min(excludedRange.endAddress, endAddress) - address;
+
+                while (index <= lastIndex) {
+                    auto& maskByte = this->payload[maskStartIndex + (index / 8)];
+
+                    if (index % 8 == 0 && (lastIndex - index) >= 7) {
+                        maskByte = 0x00;
+                        index += 8;
+                        continue;
+                    }
+
+                    maskByte = static_cast<unsigned char>(maskByte & ~(0x01 << (index % 8)));
+                    index++;
                 }
             }
         }
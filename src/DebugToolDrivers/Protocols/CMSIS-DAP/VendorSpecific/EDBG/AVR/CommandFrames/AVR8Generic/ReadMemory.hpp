@@ -6,6 +6,8 @@
 #include "Avr8GenericCommandFrame.hpp"
 #include "../../ResponseFrames/AVR8Generic/ReadMemory.hpp"
 
+#include "src/Targets/TargetMemory.hpp"
+
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames::Avr8Generic
 {
     class ReadMemory: public Avr8GenericCommandFrame<std::vector<unsigned char>>
@@ -13,11 +15,20 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr::CommandFrames
     public:
         using ExpectedResponseFrameType = ResponseFrames::Avr8Generic::ReadMemory;
 
+        /**
+         * If any excluded address ranges are provided, the masked read memory command will be used, and the bytes
+         * within those ranges will not be read (the debug tool will return 0x00 in their place).
+         *
+         * @param type
+         * @param address
+         * @param bytes
+         * @param excludedAddressRanges
+         */
         ReadMemory(
             const Avr8MemoryType& type,
             std::uint32_t address,
             std::uint32_t bytes,
-            const std::set<std::uint32_t>& excludedAddresses = {}
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
         );
     };
 }
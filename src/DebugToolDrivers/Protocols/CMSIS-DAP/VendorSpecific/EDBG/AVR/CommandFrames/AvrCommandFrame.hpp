@@ -4,13 +4,12 @@
 #include <vector>
 #include <memory>
 #include <limits>
-#include <cmath>
+#include <algorithm>
 #include <atomic>
 #include <array>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/Edbg.hpp"
-#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrCommand.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/ResponseFrames/AvrResponseFrame.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
@@ -99,75 +98,92 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         };
 
         /**
-         * Converts the command frame into a container of unsigned char - a raw buffer to include in an AVR
-         * command packet, for sending to the EDBG device.
+         * AvrCommandFrames are sent to the device via AVR commands (CMSIS-DAP vendor commands, with ID 0x80).
          *
-         * See AvrCommandFrame::generateAvrCommands() and the AvrCommand class for more.
+         * If the size of an AvrCommandFrame exceeds the maximum packet size of an AVR command, it will need to be
+         * split into multiple AVR commands before being sent to the device.
+         *
+         * This method returns the number of AVR commands required to carry this frame.
+         *
+         * @param maximumCommandPacketSize
+         *  The maximum size of an AVR command packet (the fragment of the frame carried by a single AVR command).
+         *  This is usually the packet size of the transport, minus 4 bytes to accommodate the other AVR command
+         *  fields.
          *
          * @return
          */
-        [[nodiscard]] auto getRawCommandFrame() const {
-            auto rawCommand = std::vector<unsigned char>(5 + this->payload.size());
-
-            rawCommand[0] = 0x0E; // Start of frame
-            rawCommand[1] = 0x00; // Protocol version
-
-            rawCommand[2] = static_cast<unsigned char>(this->sequenceId);
-            rawCommand[3] = static_cast<unsigned char>(this->sequenceId >> 8);
-
-            rawCommand[4] = static_cast<unsigned char>(this->protocolHandlerId);
-
-            if (!this->payload.empty()) {
-                std::copy(this->payload.begin(), this->payload.end(), rawCommand.begin() + 5);
-            }
-
-            return rawCommand;
+        [[nodiscard]] std::size_t getAvrCommandCount(std::size_t maximumCommandPacketSize) const {
+            return (this->getFrameSize() + maximumCommandPacketSize - 1) / maximumCommandPacketSize;
         }
 
         /**
-         * AvrCommandFrames are sent to the device via AvrCommands (CMSIS-DAP vendor commands).
+         * Serialises a single AVR command, carrying a fragment of this frame, directly into the given buffer.
          *
-         * If the size of an AvrCommandFrame exceeds the maximum packet size of an AVRCommand, it will need to
-         * be split into multiple AvrCommands before being sent to the device.
+         * The frame header and payload are copied straight into the buffer - no intermediate buffers are
+         * constructed. This allows the command to be serialised into a transport buffer.
          *
-         * This methods generates AVR commands from an AvrCommandFrame. The number of AvrCommands generated depends
-         * on the size of the AvrCommandFrame and the passed maximumCommandPacketSize.
+         * @param fragmentNumber
+         *  The fragment number, starting from 1. See AvrCommandFrame::getAvrCommandCount().
          *
          * @param maximumCommandPacketSize
-         *  The maximum size of an AVRCommand command packet. This is usually the REPORT_SIZE of the HID
-         *  endpoint, minus a few bytes to account for other AVRCommand fields. The maximumCommandPacketSize is used to
-         *  determine the number of AvrCommands to be generated.
+         *  See AvrCommandFrame::getAvrCommandCount().
+         *
+         * @param buffer
+         *  Must be capable of holding at least maximumCommandPacketSize + 4 bytes.
          *
          * @return
-         *  A vector of sequenced AvrCommands, each containing a segment of the AvrCommandFrame.
+         *  The number of bytes written to the buffer.
          */
-        [[nodiscard]] std::vector<AvrCommand> generateAvrCommands(std::size_t maximumCommandPacketSize) const {
-            auto rawCommandFrame = this->getRawCommandFrame();
-
-            std::size_t commandFrameSize = rawCommandFrame.size();
-            auto commandsRequired = static_cast<std::size_t>(
-                std::ceil(static_cast<float>(commandFrameSize) / static_cast<float>(maximumCommandPacketSize))
-            );
-
-            std::vector<AvrCommand> avrCommands;
-            std::size_t copiedPacketSize = 0;
-            for (std::size_t i = 0; i < commandsRequired; i++) {
-                // If we're on the last packet, the packet size will be what ever is left of the AvrCommandFrame
-                std::size_t commandPacketSize = ((i + 1) != commandsRequired) ? maximumCommandPacketSize
-                    : (commandFrameSize - (maximumCommandPacketSize * i));
-
-                avrCommands.emplace_back(AvrCommand(
-                    commandsRequired,
-                    i + 1,
-                    std::vector<unsigned char>(
-                        rawCommandFrame.begin() + static_cast<std::int64_t>(copiedPacketSize),
-                        rawCommandFrame.begin() + static_cast<std::int64_t>(copiedPacketSize + commandPacketSize)
-                    )
-                ));
-                copiedPacketSize += commandPacketSize;
+        std::size_t writeAvrCommand(
+            std::size_t fragmentNumber,
+            std::size_t maximumCommandPacketSize,
+            unsigned char* buffer
+        ) const {
+            const auto frameSize = this->getFrameSize();
+            const auto fragmentCount = this->getAvrCommandCount(maximumCommandPacketSize);
+
+            // If we're on the last fragment, the packet size will be what ever is left of the frame
+            const auto frameOffset = (fragmentNumber - 1) * maximumCommandPacketSize;
+            const auto commandPacketSize = std::min(maximumCommandPacketSize, frameSize - frameOffset);
+
+            buffer[0] = 0x80; // AVR command ID
+            buffer[1] = static_cast<unsigned char>((fragmentNumber << 4) | fragmentCount); // Fragment info
+
+            // Packet size is two bytes, MSB
+            buffer[2] = static_cast<unsigned char>(commandPacketSize >> 8);
+            buffer[3] = static_cast<unsigned char>(commandPacketSize & 0xFF);
+
+            auto* commandPacket = buffer + 4;
+            auto frameIndex = frameOffset;
+            const auto frameEnd = frameOffset + commandPacketSize;
+
+            if (frameIndex < AvrCommandFrame::FRAME_HEADER_SIZE) {
+                const auto header = std::array<unsigned char, AvrCommandFrame::FRAME_HEADER_SIZE>({
+                    0x0E, // Start of frame
+                    0x00, // Protocol version
+                    static_cast<unsigned char>(this->sequenceId),
+                    static_cast<unsigned char>(this->sequenceId >> 8),
+                    static_cast<unsigned char>(this->protocolHandlerId),
+                });
+
+                const auto headerEnd = std::min(frameEnd, AvrCommandFrame::FRAME_HEADER_SIZE);
+                commandPacket = std::copy(
+                    header.begin() + static_cast<long>(frameIndex),
+                    header.begin() + static_cast<long>(headerEnd),
+                    commandPacket
+                );
+                frameIndex = headerEnd;
+            }
+
+            if (frameIndex < frameEnd) {
+                std::copy(
+                    this->payload.begin() + static_cast<long>(frameIndex - AvrCommandFrame::FRAME_HEADER_SIZE),
+                    this->payload.begin() + static_cast<long>(frameEnd - AvrCommandFrame::FRAME_HEADER_SIZE),
+                    commandPacket
+                );
             }
 
-            return avrCommands;
+            return 4 + commandPacketSize;
         }
 
     protected:
@@ -182,5 +198,15 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         ProtocolHandlerId protocolHandlerId = ProtocolHandlerId::DISCOVERY;
 
         PayloadContainerType payload;
+
+    private:
+        /**
+         * SOF, protocol version, sequence ID (two bytes) and protocol handler ID.
+         */
+        static constexpr std::size_t FRAME_HEADER_SIZE = 5;
+
+        [[nodiscard]] std::size_t getFrameSize() const {
+            return AvrCommandFrame::FRAME_HEADER_SIZE + this->payload.size();
+        }
     };
 }
@@ -3,6 +3,9 @@
 #include <cstdint>
 #include <thread>
 #include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <limits>
 
 #include "src/Logger/Logger.hpp"
 #include "src/Helpers/Paths.hpp"
@@ -36,6 +39,7 @@
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/EnterProgrammingMode.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/LeaveProgrammingMode.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AVR8Generic/EraseMemory.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/Discovery/Query.hpp"
 
 // AVR events
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/Events/AVR8Generic/BreakEvent.hpp"
@@ -74,6 +78,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     using Bloom::Targets::TargetState;
     using Bloom::Targets::TargetMemoryType;
     using Bloom::Targets::TargetMemoryBuffer;
+    using Bloom::Targets::TargetMemoryAddressRange;
     using Bloom::Targets::TargetRegister;
     using Bloom::Targets::TargetRegisterDescriptor;
     using Bloom::Targets::TargetRegisterDescriptors;
@@ -84,6 +89,10 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         : edbgInterface(edbgInterface)
     {}
 
+    EdbgAvr8Interface::~EdbgAvr8Interface() {
+        this->stopEventReader();
+    }
+
     void EdbgAvr8Interface::configure(const Targets::Microchip::Avr::Avr8Bit::Avr8TargetConfig& targetConfig) {
         this->targetConfig = targetConfig;
 
@@ -217,6 +226,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
 
         this->targetState = TargetState::RUNNING;
+        this->notifyEventReader();
     }
 
     void EdbgAvr8Interface::runTo(std::uint32_t address) {
@@ -230,6 +240,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
 
         this->targetState = TargetState::RUNNING;
+        this->notifyEventReader();
     }
 
     void EdbgAvr8Interface::step() {
@@ -242,6 +253,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
 
         this->targetState = TargetState::RUNNING;
+        this->notifyEventReader();
     }
 
     void EdbgAvr8Interface::reset() {
@@ -285,9 +297,25 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         if (!this->targetAttached) {
             this->attach();
         }
+
+        if (
+            this->targetConfig->calibrateMemoryAccess
+            && this->memoryAccessProfiles.empty()
+            && this->getTargetState() == TargetState::STOPPED
+        ) {
+            try {
+                this->calibrateMemoryAccess();
+
+            } catch (const Exception& exception) {
+                this->memoryAccessProfiles.clear();
+                Logger::warning("Memory access calibration failed - " + exception.getMessage());
+            }
+        }
     }
 
     void EdbgAvr8Interface::deactivate() {
+        this->stopEventReader();
+
         if (this->targetAttached) {
             if (
                 this->targetConfig->physicalInterface == PhysicalInterface::DEBUG_WIRE
@@ -391,8 +419,20 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     }
 
     void EdbgAvr8Interface::setBreakpoint(std::uint32_t address) {
+        this->setBreakpoints({address});
+    }
+
+    void EdbgAvr8Interface::clearBreakpoint(std::uint32_t address) {
+        this->clearBreakpoints({address});
+    }
+
+    void EdbgAvr8Interface::setBreakpoints(const std::vector<std::uint32_t>& addresses) {
+        if (addresses.empty()) {
+            return;
+        }
+
         auto response = this->edbgInterface.sendAvrCommandFrameAndWaitForResponseFrame(
-            SetSoftwareBreakpoints({address})
+            SetSoftwareBreakpoints(addresses)
         );
 
         if (response.getResponseId() == Avr8ResponseId::FAILED) {
@@ -400,9 +440,13 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
     }
 
-    void EdbgAvr8Interface::clearBreakpoint(std::uint32_t address) {
+    void EdbgAvr8Interface::clearBreakpoints(const std::vector<std::uint32_t>& addresses) {
+        if (addresses.empty()) {
+            return;
+        }
+
         auto response = this->edbgInterface.sendAvrCommandFrameAndWaitForResponseFrame(
-            ClearSoftwareBreakpoints({address})
+            ClearSoftwareBreakpoints(addresses)
         );
 
         if (response.getResponseId() == Avr8ResponseId::FAILED) {
@@ -427,28 +471,16 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * means we will be frequently loading over 100 register values in a single instance.
          *
          * For the above reason, we do not read each register value individually. That would take far too long if we
-         * have over 100 registers to read. Instead, we group the register descriptors into collections by register
-         * type, and resolve the address range for each collection. We then perform a single read operation for
-         * each collection and hold the memory buffer in a random access container (std::vector). Finally, we extract
-         * the data for each register descriptor, from the memory buffer, and construct the relevant TargetRegister
-         * object.
-         *
-         * TODO: We should be grouping the register descriptors by memory type, as opposed to register type. This
-         *       isn't much of a problem ATM, as currently, we only work with registers that are stored in the data
-         *       address space or the register file. This will need to be addressed before we can work with any other
-         *       registers stored elsewhere.
+         * have over 100 registers to read. Instead, we group the register descriptors by memory type and use the
+         * MemoryReadPlanner to combine them into as few read operations as possible. Registers separated by a small
+         * gap will be read in a single operation, whereas registers separated by a large gap will be read
+         * separately. See EdbgAvr8Interface::getReadCostModel() for how we decide. Finally, we extract the data for
+         * each register descriptor, from the relevant memory buffer, and construct the TargetRegister object.
          */
         auto output = TargetRegisters();
 
-        // Group descriptors by type and resolve the address range for each type
-        auto descriptorsByType = std::map<TargetRegisterType, std::set<const TargetRegisterDescriptor*>>();
-
-        /*
-         * An address range is just an std::pair of integers - the first being the start address, the second being the
-         * end address.
-         */
-        using AddressRange = std::pair<std::uint32_t, std::uint32_t>;
-        auto addressRangeByType = std::map<TargetRegisterType, AddressRange>();
+        auto readPlanner = MemoryReadPlanner();
+        auto descriptorsByMemoryType = std::map<Avr8MemoryType, std::vector<const TargetRegisterDescriptor*>>();
 
         for (const auto& descriptor : descriptors) {
             if (!descriptor.startAddress.has_value()) {
@@ -459,47 +491,19 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                 continue;
             }
 
-            descriptorsByType[descriptor.type].insert(&descriptor);
-
-            const auto startAddress = descriptor.startAddress.value();
-            const auto endAddress = startAddress + (descriptor.size - 1);
+            const auto memoryType = this->getRegisterMemoryType(descriptor.type);
 
-            if (!addressRangeByType.contains(descriptor.type)) {
-                auto addressRange = AddressRange();
-                addressRange.first = startAddress;
-                addressRange.second = endAddress;
-                addressRangeByType[descriptor.type] = addressRange;
-
-            } else {
-                auto& addressRange = addressRangeByType[descriptor.type];
-
-                if (startAddress < addressRange.first) {
-                    addressRange.first = startAddress;
-                }
-
-                if (endAddress > addressRange.second) {
-                    addressRange.second = endAddress;
-                }
-            }
+            descriptorsByMemoryType[memoryType].push_back(&descriptor);
+            readPlanner.addRead(memoryType, descriptor.startAddress.value(), descriptor.size);
         }
 
-        /*
-         * Now that we have our address ranges and grouped descriptors, we can perform a single read call for each
-         * register type.
-         */
-        for (const auto&[registerType, descriptors] : descriptorsByType) {
-            const auto& addressRange = addressRangeByType[registerType];
-            const auto startAddress = addressRange.first;
-            const auto endAddress = addressRange.second;
-            const auto bufferSize = (endAddress - startAddress) + 1;
-
-            const auto memoryType = (registerType != TargetRegisterType::GENERAL_PURPOSE_REGISTER) ?
-                Avr8MemoryType::SRAM
-                : (this->configVariant == Avr8ConfigVariant::XMEGA || this->configVariant == Avr8ConfigVariant::UPDI
-                ? Avr8MemoryType::REGISTER_FILE : Avr8MemoryType::SRAM);
+        const auto plannedReads = readPlanner.plan([this] (Avr8MemoryType memoryType) {
+            return this->getReadCostModel(memoryType);
+        });
 
+        for (const auto& [memoryType, addressRanges] : plannedReads) {
             /*
-             * When reading the entire range, we must avoid any attempts to access the OCD data register (OCDDR), as
+             * When reading a range of memory, we must avoid any attempts to access the OCD data register (OCDDR), as
              * the debug tool will reject the command and respond with a 0x36 error code (invalid address error).
              *
              * For this reason, we specify the OCDDR address as an excluded address. This will mean
@@ -519,39 +523,61 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
              *
              * See CommandFrames::Avr8Generic::ReadMemory(); and the Microchip EDBG documentation for more.
              */
-            auto excludedAddresses = std::set<std::uint32_t>();
+            auto excludedAddressRanges = std::set<TargetMemoryAddressRange>();
             if (memoryType == Avr8MemoryType::SRAM && this->targetParameters.ocdDataRegister.has_value()) {
-                excludedAddresses.insert(
-                    this->targetParameters.ocdDataRegister.value()
-                        + this->targetParameters.mappedIoSegmentStartAddress.value_or(0)
-                );
+                const auto ocdDataRegisterAddress = this->targetParameters.ocdDataRegister.value()
+                    + this->targetParameters.mappedIoSegmentStartAddress.value_or(0);
+
+                excludedAddressRanges.emplace(ocdDataRegisterAddress, ocdDataRegisterAddress);
             }
 
-            const auto flatMemoryBuffer = this->readMemory(
-                memoryType,
-                startAddress,
-                bufferSize,
-                excludedAddresses
-            );
+            auto memoryBuffers = std::vector<TargetMemoryBuffer>();
+            memoryBuffers.reserve(addressRanges.size());
 
-            if (flatMemoryBuffer.size() != bufferSize) {
-                throw Exception(
-                    "Failed to read memory within register type address range (" + std::to_string(startAddress)
-                        + " - " + std::to_string(endAddress) + "). Expected " + std::to_string(bufferSize)
-                        + " bytes, got " + std::to_string(flatMemoryBuffer.size())
+            for (const auto& addressRange : addressRanges) {
+                const auto bufferSize = (addressRange.endAddress - addressRange.startAddress) + 1;
+
+                auto memoryBuffer = this->readMemory(
+                    memoryType,
+                    addressRange.startAddress,
+                    bufferSize,
+                    excludedAddressRanges
                 );
+
+                if (memoryBuffer.size() != bufferSize) {
+                    throw Exception(
+                        "Failed to read memory within register address range ("
+                            + std::to_string(addressRange.startAddress) + " - "
+                            + std::to_string(addressRange.endAddress) + "). Expected " + std::to_string(bufferSize)
+                            + " bytes, got " + std::to_string(memoryBuffer.size())
+                    );
+                }
+
+                memoryBuffers.emplace_back(std::move(memoryBuffer));
             }
 
-            // Construct our TargetRegister objects directly from the flat memory buffer
-            for (const auto& descriptor : descriptors) {
+            // Construct our TargetRegister objects directly from the memory buffers
+            for (const auto* descriptor : descriptorsByMemoryType.at(memoryType)) {
+                const auto registerStartAddress = descriptor->startAddress.value();
+
+                // The planned address ranges are ordered by start address, and every register falls within one of them
+                const auto addressRangeIt = std::prev(std::upper_bound(
+                    addressRanges.begin(),
+                    addressRanges.end(),
+                    TargetMemoryAddressRange(registerStartAddress, registerStartAddress)
+                ));
+                const auto& memoryBuffer = memoryBuffers.at(
+                    static_cast<std::size_t>(std::distance(addressRanges.begin(), addressRangeIt))
+                );
+
                 /*
                  * Multibyte AVR8 registers are stored in LSB form.
                  *
-                 * This is why we use reverse iterators when extracting our data from flatMemoryBuffer. Doing so allows
-                 * us to extract the data in MSB form (as is expected for all register values held in TargetRegister
-                 * objects).
+                 * This is why we use reverse iterators when extracting our data from the memory buffer. Doing so
+                 * allows us to extract the data in MSB form (as is expected for all register values held in
+                 * TargetRegister objects).
                  */
-                const auto bufferStartIt = flatMemoryBuffer.rend() - (descriptor->startAddress.value() - startAddress)
+                const auto bufferStartIt = memoryBuffer.rend() - (registerStartAddress - addressRangeIt->startAddress)
                     - descriptor->size;
 
                 output.emplace_back(
@@ -567,6 +593,21 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     }
 
     void EdbgAvr8Interface::writeRegisters(const Targets::TargetRegisters& registers) {
+        /*
+         * Writing each register individually would require a write command (and a USB round trip) per register. GDB
+         * writes all of the general purpose registers, along with the stack pointer and status register, in one go.
+         *
+         * So we collect the register values into a byte map for each memory type, and then issue a single write
+         * command for each contiguous run of bytes. Later registers take precedence over earlier ones, should any
+         * overlap.
+         *
+         * We don't bridge gaps between registers, as the EDBG protocol has no masked write command. Bridging a gap
+         * would require reading its contents first, which costs as much as the write we'd be saving. It would also
+         * mean writing back to registers that weren't part of the request, which can have side effects for I/O
+         * registers.
+         */
+        auto bytesByMemoryType = std::map<Avr8MemoryType, std::map<std::uint32_t, unsigned char>>();
+
         for (const auto& reg : registers) {
             const auto& registerDescriptor = reg.descriptor;
             auto registerValue = reg.value;
@@ -589,20 +630,36 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                 std::reverse(registerValue.begin(), registerValue.end());
             }
 
-            auto memoryType = Avr8MemoryType::SRAM;
-            if (
-                registerDescriptor.type == TargetRegisterType::GENERAL_PURPOSE_REGISTER
-                && (this->configVariant == Avr8ConfigVariant::XMEGA || this->configVariant == Avr8ConfigVariant::UPDI)
-            ) {
-                memoryType = Avr8MemoryType::REGISTER_FILE;
+            auto& bytesByAddress = bytesByMemoryType[this->getRegisterMemoryType(registerDescriptor.type)];
+            auto address = registerDescriptor.startAddress.value();
+
+            for (const auto& byte : registerValue) {
+                bytesByAddress[address++] = byte;
             }
+        }
 
-            // TODO: This can be inefficient when updating many registers, maybe do something a little smarter here.
-            this->writeMemory(
-                memoryType,
-                registerDescriptor.startAddress.value(),
-                registerValue
-            );
+        for (const auto& [memoryType, bytesByAddress] : bytesByMemoryType) {
+            auto startAddress = bytesByAddress.begin()->first;
+            auto buffer = TargetMemoryBuffer();
+
+            for (const auto& [address, byte] : bytesByAddress) {
+                const auto contiguous = address == startAddress + buffer.size();
+                const auto maximumSizeReached = this->maximumMemoryAccessSizePerRequest.has_value()
+                    && buffer.size() >= this->maximumMemoryAccessSizePerRequest.value();
+
+                if (!buffer.empty() && (!contiguous || maximumSizeReached)) {
+                    this->writeMemory(memoryType, startAddress, buffer);
+                    buffer.clear();
+                }
+
+                if (buffer.empty()) {
+                    startAddress = address;
+                }
+
+                buffer.push_back(byte);
+            }
+
+            this->writeMemory(memoryType, startAddress, buffer);
         }
     }
 
@@ -661,27 +718,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             }
         }
 
-        /*
-         * The internal readMemory() function accepts excluded addresses in the form of a set of addresses, as
-         * opposed to a set of address ranges.
-         *
-         * We will perform the conversion here.
-         */
-        auto excludedAddresses = std::set<std::uint32_t>();
-        auto endAddress = startAddress + bytes - 1;
-
-        for (const auto& addressRange : excludedAddressRanges) {
-            if (addressRange.startAddress > endAddress) {
-                // This address range is outside of the range from which we will be reading
-                continue;
-            }
-
-            for (auto i = addressRange.startAddress; i <= addressRange.endAddress; i++) {
-                excludedAddresses.insert(i);
-            }
-        }
-
-        return this->readMemory(avr8MemoryType, startAddress, bytes, excludedAddresses);
+        return this->readMemory(avr8MemoryType, startAddress, bytes, excludedAddressRanges);
     }
 
     void EdbgAvr8Interface::writeMemory(
@@ -752,6 +789,39 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         }
     }
 
+    bool EdbgAvr8Interface::pageGranularProgrammingSupported() {
+        return this->configVariant == Avr8ConfigVariant::DEBUG_WIRE || this->configVariant == Avr8ConfigVariant::XMEGA;
+    }
+
+    void EdbgAvr8Interface::eraseProgramMemoryPage(std::uint32_t pageStartAddress) {
+        if (this->configVariant == Avr8ConfigVariant::DEBUG_WIRE) {
+            // The debug tool will erase the page when we write to it
+            return;
+        }
+
+        if (this->configVariant != Avr8ConfigVariant::XMEGA) {
+            throw Exception("AVR8 page erase not supported for this config variant.");
+        }
+
+        auto eraseMode = Avr8EraseMemoryMode::APPLICATION_PAGE;
+        const auto bootSectionStartAddress = this->targetParameters.bootSectionStartAddress.value();
+
+        if (pageStartAddress >= bootSectionStartAddress) {
+            eraseMode = Avr8EraseMemoryMode::BOOT_PAGE;
+
+            // As with the BOOT_FLASH memory type, the address should be relative to the start of the boot section.
+            pageStartAddress -= bootSectionStartAddress;
+        }
+
+        auto response = this->edbgInterface.sendAvrCommandFrameAndWaitForResponseFrame(
+            EraseMemory(eraseMode, pageStartAddress)
+        );
+
+        if (response.getResponseId() == Avr8ResponseId::FAILED) {
+            throw Avr8CommandFailure("AVR8 erase memory (page) command failed", response);
+        }
+    }
+
     TargetState EdbgAvr8Interface::getTargetState() {
         /*
          * We are not informed when a target goes from a stopped state to a running state, so there is no need
@@ -767,6 +837,24 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         return this->targetState;
     }
 
+    bool EdbgAvr8Interface::setTargetStateChangeNotifier(NotifierInterface* notifier) {
+        this->stopEventReader();
+        this->targetStateChangeNotifier = notifier;
+
+        if (notifier == nullptr) {
+            return false;
+        }
+
+        {
+            const auto lock = std::unique_lock(this->eventMutex);
+            this->eventReaderStopRequested = false;
+        }
+
+        this->eventReaderActive = true;
+        this->eventReaderThread = std::thread(&EdbgAvr8Interface::readEvents, this);
+        return true;
+    }
+
     void EdbgAvr8Interface::enableProgrammingMode() {
         auto response = this->edbgInterface.sendAvrCommandFrameAndWaitForResponseFrame(
             EnterProgrammingMode()
@@ -1425,7 +1513,28 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     }
 
     std::unique_ptr<AvrEvent> EdbgAvr8Interface::getAvrEvent() {
-        auto event = this->edbgInterface.requestAvrEvent();
+        auto event = std::optional<AvrEvent>();
+
+        {
+            const auto lock = std::unique_lock(this->eventMutex);
+
+            if (!this->eventQueue.empty()) {
+                event = std::move(this->eventQueue.front());
+                this->eventQueue.pop_front();
+            }
+        }
+
+        if (event.has_value()) {
+            // The event reader may have been waiting for us to consume the queued events
+            this->eventCondition.notify_all();
+
+        } else if (!this->eventReaderActive || this->targetState != TargetState::RUNNING) {
+            /*
+             * The event reader only drains events whilst the target is running. At all other times, we request them
+             * from the debug tool ourselves.
+             */
+            event = this->edbgInterface.requestAvrEvent();
+        }
 
         if (!event.has_value()) {
             return nullptr;
@@ -1450,6 +1559,85 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         while (this->getAvrEvent() != nullptr) {}
     }
 
+    void EdbgAvr8Interface::stopEventReader() {
+        {
+            const auto lock = std::unique_lock(this->eventMutex);
+            this->eventReaderStopRequested = true;
+        }
+
+        this->eventCondition.notify_all();
+
+        if (this->eventReaderThread.joinable()) {
+            this->eventReaderThread.join();
+        }
+
+        this->eventReaderActive = false;
+    }
+
+    void EdbgAvr8Interface::notifyEventReader() {
+        {
+            // Acquiring the mutex here ensures the event reader cannot miss the notification
+            const auto lock = std::unique_lock(this->eventMutex);
+        }
+
+        this->eventCondition.notify_all();
+    }
+
+    void EdbgAvr8Interface::readEvents() {
+        while (true) {
+            {
+                auto lock = std::unique_lock(this->eventMutex);
+                this->eventCondition.wait(lock, [this] {
+                    return this->eventReaderStopRequested
+                        || (this->targetState == TargetState::RUNNING && this->eventQueue.empty());
+                });
+
+                if (this->eventReaderStopRequested) {
+                    return;
+                }
+            }
+
+            auto event = std::optional<AvrEvent>();
+
+            try {
+                event = this->edbgInterface.requestAvrEvent();
+
+            } catch (const Exception& exception) {
+                /*
+                 * We can't recover from this here. Wake the TargetController, which will request events from the
+                 * debug tool directly, and deal with the failure itself.
+                 */
+                Logger::error("AVR event reader failed - " + exception.getMessage());
+                this->eventReaderActive = false;
+
+                if (auto* notifier = this->targetStateChangeNotifier.load()) {
+                    notifier->notify();
+                }
+
+                return;
+            }
+
+            auto lock = std::unique_lock(this->eventMutex);
+
+            if (!event.has_value()) {
+                this->eventCondition.wait_for(lock, EdbgAvr8Interface::EVENT_POLL_INTERVAL, [this] {
+                    return this->eventReaderStopRequested;
+                });
+                continue;
+            }
+
+            const auto isBreakEvent = event->getEventId() == AvrEventId::AVR8_BREAK_EVENT;
+            this->eventQueue.push_back(std::move(event.value()));
+            lock.unlock();
+
+            if (isBreakEvent) {
+                if (auto* notifier = this->targetStateChangeNotifier.load()) {
+                    notifier->notify();
+                }
+            }
+        }
+    }
+
     bool EdbgAvr8Interface::alignmentRequired(Avr8MemoryType memoryType) {
         return
             memoryType == Avr8MemoryType::FLASH_PAGE
@@ -1545,17 +1733,363 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         return bytes;
     }
 
+    Avr8MemoryType EdbgAvr8Interface::getRegisterMemoryType(TargetRegisterType registerType) {
+        if (
+            registerType == TargetRegisterType::GENERAL_PURPOSE_REGISTER
+            && (this->configVariant == Avr8ConfigVariant::XMEGA || this->configVariant == Avr8ConfigVariant::UPDI)
+        ) {
+            return Avr8MemoryType::REGISTER_FILE;
+        }
+
+        return Avr8MemoryType::SRAM;
+    }
+
+    MemoryReadCostModel EdbgAvr8Interface::getReadCostModel(Avr8MemoryType memoryType) {
+        auto costModel = MemoryReadCostModel();
+        costModel.alignTo = this->alignMemoryBytes(memoryType, 1);
+        costModel.maximumReadSize = this->getMaximumReadSize(memoryType);
+
+        const auto profileIt = this->memoryAccessProfiles.find(memoryType);
+        if (profileIt != this->memoryAccessProfiles.end()) {
+            // Express the measured cost of issuing a command in terms of the measured cost of reading a byte
+            const auto& profile = profileIt->second;
+            costModel.requestCost = static_cast<std::uint32_t>(std::min(
+                static_cast<std::uint64_t>(profile.requestLatency) * 1000
+                    / std::max(profile.byteLatency, std::uint32_t(1)),
+                static_cast<std::uint64_t>(std::numeric_limits<std::uint32_t>::max())
+            ));
+            costModel.byteCost = 1;
+
+            return costModel;
+        }
+
+        /*
+         * For EDBG debug tools, the time taken to service a read command is dominated by the USB packets - one
+         * packet for the command and at least one for the response. Each packet is serviced in a separate USB frame.
+         *
+         * We express the costs in terms of response payload bytes. A single packet can carry roughly
+         * (packet size - 20) bytes of memory data (see EdbgAvr8Interface::readMemory()), so issuing another command
+         * costs about as much as reading two packets' worth of data.
+         */
+        const auto singlePacketSize = static_cast<std::uint32_t>(
+            this->edbgInterface.getPacketSize() - 20
+        );
+
+        costModel.requestCost = singlePacketSize * 2;
+        costModel.byteCost = 1;
+
+        return costModel;
+    }
+
+    std::optional<std::uint32_t> EdbgAvr8Interface::getMaximumReadSize(Avr8MemoryType memoryType) {
+        if (
+            memoryType == Avr8MemoryType::FLASH_PAGE
+            || memoryType == Avr8MemoryType::SPM
+            || memoryType == Avr8MemoryType::APPL_FLASH
+            || memoryType == Avr8MemoryType::BOOT_FLASH
+        ) {
+            // Flash reads are split by page. See EdbgAvr8Interface::readMemory()
+            return this->maximumMemoryAccessSizePerRequest;
+        }
+
+        const auto profileIt = this->memoryAccessProfiles.find(memoryType);
+        if (profileIt != this->memoryAccessProfiles.end()) {
+            // Calibration never probes beyond this->maximumMemoryAccessSizePerRequest
+            return profileIt->second.maximumReadSize;
+        }
+
+        /*
+         * EDBG AVR8 debug tools behave in a really weird way when responding with more than two packets
+         * for a single read (non-flash) memory command. The data they return in this case appears to be of little
+         * use.
+         *
+         * To address this, we make sure we only issue read memory commands that will result in no more than two
+         * response packets. For calls that require more than this, we simply split them into numerous calls.
+         *
+         * The subtraction of 20 bytes here is just to account for any other bytes included in the response
+         * that isn't actually the memory data (like the command ID, version bytes, etc). I could have sought the
+         * actual value but who has the time. It won't exceed 20 bytes. Bite me.
+         */
+        auto maximumReadSize = static_cast<std::uint32_t>(this->edbgInterface.getPacketSize() - 20) * 2;
+
+        if (this->maximumMemoryAccessSizePerRequest.has_value()) {
+            maximumReadSize = std::min(maximumReadSize, this->maximumMemoryAccessSizePerRequest.value());
+        }
+
+        // Keep each read aligned, for memory types that require it
+        const auto alignTo = this->alignMemoryBytes(memoryType, 1);
+        if (maximumReadSize > alignTo) {
+            maximumReadSize -= maximumReadSize % alignTo;
+        }
+
+        return maximumReadSize;
+    }
+
+    void EdbgAvr8Interface::calibrateMemoryAccess() {
+        auto physicalInterfaceName = std::string();
+        switch (this->targetConfig->physicalInterface) {
+            case PhysicalInterface::DEBUG_WIRE: {
+                physicalInterfaceName = "debug-wire";
+                break;
+            }
+            case PhysicalInterface::JTAG: {
+                physicalInterfaceName = "jtag";
+                break;
+            }
+            case PhysicalInterface::PDI: {
+                physicalInterfaceName = "pdi";
+                break;
+            }
+            case PhysicalInterface::UPDI: {
+                physicalInterfaceName = "updi";
+                break;
+            }
+        }
+
+        const auto serialNumber = this->getToolSerialNumber();
+        auto cache = MemoryAccessProfileCache(Paths::projectSettingsDirPath() + "/edbg-memory-access-profiles.json");
+
+        const auto cachedProfiles = cache.get(serialNumber, physicalInterfaceName);
+        if (cachedProfiles.has_value()) {
+            Logger::debug("Using cached memory access profiles for debug tool " + serialNumber);
+            this->memoryAccessProfiles = cachedProfiles.value();
+            return;
+        }
+
+        Logger::info("Calibrating memory access for debug tool " + serialNumber);
+
+        auto profiles = MemoryAccessProfiles();
+
+        if (this->targetParameters.ramStartAddress.has_value() && this->targetParameters.ramSize.has_value()) {
+            const auto profile = this->profileMemoryAccess(
+                Avr8MemoryType::SRAM,
+                this->targetParameters.ramStartAddress.value(),
+                this->targetParameters.ramSize.value()
+            );
+
+            if (profile.has_value()) {
+                profiles.insert(std::pair(Avr8MemoryType::SRAM, profile.value()));
+            }
+        }
+
+        if (this->targetParameters.eepromStartAddress.has_value() && this->targetParameters.eepromSize.has_value()) {
+            const auto profile = this->profileMemoryAccess(
+                Avr8MemoryType::EEPROM,
+                this->targetParameters.eepromStartAddress.value(),
+                this->targetParameters.eepromSize.value()
+            );
+
+            if (profile.has_value()) {
+                profiles.insert(std::pair(Avr8MemoryType::EEPROM, profile.value()));
+            }
+        }
+
+        for (const auto& [memoryType, profile] : profiles) {
+            Logger::debug(
+                "Memory type 0x" + std::to_string(static_cast<int>(memoryType)) + " - maximum read size: "
+                    + std::to_string(profile.maximumReadSize) + " bytes, request latency: "
+                    + std::to_string(profile.requestLatency) + "us, byte latency: "
+                    + std::to_string(profile.byteLatency) + "ns"
+            );
+        }
+
+        this->memoryAccessProfiles = profiles;
+
+        if (profiles.empty()) {
+            return;
+        }
+
+        try {
+            cache.store(serialNumber, physicalInterfaceName, profiles);
+
+        } catch (const Exception& exception) {
+            Logger::warning("Failed to cache memory access profiles - " + exception.getMessage());
+        }
+    }
+
+    std::optional<MemoryAccessProfile> EdbgAvr8Interface::profileMemoryAccess(
+        Avr8MemoryType memoryType,
+        std::uint32_t regionStartAddress,
+        std::uint32_t regionSize
+    ) {
+        const auto singlePacketSize = static_cast<std::uint32_t>(this->edbgInterface.getPacketSize() - 20);
+        const auto alignTo = this->alignMemoryBytes(memoryType, 1);
+
+        auto ceiling = std::min(regionSize, singlePacketSize * EdbgAvr8Interface::MAXIMUM_CALIBRATION_RESPONSE_PACKETS);
+        if (this->maximumMemoryAccessSizePerRequest.has_value()) {
+            ceiling = std::min(ceiling, this->maximumMemoryAccessSizePerRequest.value());
+        }
+
+        ceiling -= ceiling % alignTo;
+
+        // Reads of this size are known to be reliable - see EdbgAvr8Interface::getMaximumReadSize()
+        auto baselineSize = std::min(singlePacketSize * 2, ceiling);
+        baselineSize -= baselineSize % alignTo;
+
+        if (baselineSize == 0) {
+            return std::nullopt;
+        }
+
+        auto referenceBuffer = TargetMemoryBuffer();
+        referenceBuffer.reserve(ceiling);
+
+        while (referenceBuffer.size() < ceiling) {
+            auto data = this->sendReadMemoryCommand(
+                memoryType,
+                static_cast<std::uint32_t>(regionStartAddress + referenceBuffer.size()),
+                std::min(baselineSize, static_cast<std::uint32_t>(ceiling - referenceBuffer.size()))
+            );
+            std::move(data.begin(), data.end(), std::back_inserter(referenceBuffer));
+        }
+
+        auto profile = MemoryAccessProfile();
+        profile.maximumReadSize = baselineSize;
+
+        /*
+         * Grow the read size by one packet at a time. We stop at the first read that is rejected by the tool or
+         * returns data that doesn't match the reference copy.
+         *
+         * Any other failure (such as a USB communication failure) is not something we can recover from here, so we
+         * let it propagate.
+         */
+        const auto readSizeStep = singlePacketSize - (singlePacketSize % alignTo);
+
+        for (
+            auto readSize = baselineSize + readSizeStep;
+            readSizeStep > 0 && readSize <= ceiling;
+            readSize += readSizeStep
+        ) {
+            try {
+                const auto data = this->sendReadMemoryCommand(memoryType, regionStartAddress, readSize);
+
+                if (
+                    data.size() != readSize
+                    || !std::equal(data.begin(), data.end(), referenceBuffer.begin())
+                ) {
+                    break;
+                }
+
+            } catch (const Avr8CommandFailure&) {
+                break;
+            }
+
+            profile.maximumReadSize = readSize;
+        }
+
+        /*
+         * Measure the time taken to service the smallest and the largest reads. The difference gives us the cost of
+         * each additional byte, and what remains of the smallest read is the fixed cost of issuing a command.
+         *
+         * The fixed cost includes the minimum time gap we enforce between commands, as that's a cost we incur for
+         * every command we send.
+         */
+        const auto timeReads = [this, memoryType, regionStartAddress] (std::uint32_t readSize) {
+            const auto startTime = std::chrono::steady_clock::now();
+
+            for (auto i = std::uint32_t(0); i < EdbgAvr8Interface::CALIBRATION_TIMING_READS; i++) {
+                this->sendReadMemoryCommand(memoryType, regionStartAddress, readSize);
+            }
+
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - startTime
+            ).count()) / EdbgAvr8Interface::CALIBRATION_TIMING_READS;
+        };
+
+        const auto smallReadTime = timeReads(alignTo);
+        const auto largeReadTime = timeReads(profile.maximumReadSize);
+
+        if (profile.maximumReadSize > alignTo && largeReadTime > smallReadTime) {
+            profile.byteLatency = static_cast<std::uint32_t>(
+                (largeReadTime - smallReadTime) / (profile.maximumReadSize - alignTo)
+            );
+        }
+
+        const auto smallReadByteTime = static_cast<std::uint64_t>(profile.byteLatency) * alignTo;
+        profile.requestLatency = smallReadTime > smallReadByteTime
+            ? static_cast<std::uint32_t>((smallReadTime - smallReadByteTime) / 1000)
+            : 0;
+
+        return profile;
+    }
+
+    std::string EdbgAvr8Interface::getToolSerialNumber() {
+        using CommandFrames::Discovery::Query;
+        using CommandFrames::Discovery::QueryContext;
+        using ResponseFrames::Discovery::ResponseId;
+
+        auto response = this->edbgInterface.sendAvrCommandFrameAndWaitForResponseFrame(
+            Query(QueryContext::SERIAL_NUMBER)
+        );
+
+        if (response.getResponseId() != ResponseId::OK) {
+            throw Exception("Failed to fetch serial number from debug tool - invalid Discovery Protocol response ID.");
+        }
+
+        const auto data = response.getPayloadData();
+        return std::string(data.begin(), data.end());
+    }
+
+    std::set<TargetMemoryAddressRange> EdbgAvr8Interface::clipExcludedAddressRanges(
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges,
+        std::uint32_t startAddress,
+        std::uint32_t endAddress
+    ) {
+        auto output = std::set<TargetMemoryAddressRange>();
+        auto pendingRange = std::optional<TargetMemoryAddressRange>();
+
+        // The ranges are ordered by start address, so any that overlap or adjoin will be adjacent in the set.
+        for (const auto& excludedRange : excludedAddressRanges) {
+            if (excludedRange.startAddress > endAddress) {
+                break;
+            }
+
+            if (excludedRange.endAddress < startAddress) {
+                continue;
+            }
+
+            const auto clippedRange = TargetMemoryAddressRange(
+                std::max(excludedRange.startAddress, startAddress),
+                std::min(excludedRange.endAddress, endAddress)
+            );
+
+            if (pendingRange.has_value() && clippedRange.startAddress <= pendingRange->endAddress + 1) {
+                pendingRange->endAddress = std::max(pendingRange->endAddress, clippedRange.endAddress);
+                continue;
+            }
+
+            if (pendingRange.has_value()) {
+                output.insert(*pendingRange);
+            }
+
+            pendingRange = clippedRange;
+        }
+
+        if (pendingRange.has_value()) {
+            output.insert(*pendingRange);
+        }
+
+        return output;
+    }
+
     TargetMemoryBuffer EdbgAvr8Interface::readMemory(
         Avr8MemoryType type,
         std::uint32_t startAddress,
         std::uint32_t bytes,
-        const std::set<std::uint32_t>& excludedAddresses
+        const std::set<TargetMemoryAddressRange>& requestedExcludedAddressRanges
     ) {
-        if (!excludedAddresses.empty() && (this->avoidMaskedMemoryRead || type != Avr8MemoryType::SRAM)) {
+        const auto excludedAddressRanges = bytes > 0
+            ? EdbgAvr8Interface::clipExcludedAddressRanges(
+                requestedExcludedAddressRanges,
+                startAddress,
+                startAddress + bytes - 1
+            )
+            : std::set<TargetMemoryAddressRange>();
+
+        if (!excludedAddressRanges.empty() && (this->avoidMaskedMemoryRead || type != Avr8MemoryType::SRAM)) {
             /*
              * Driver-side masked memory read.
              *
-             * Split the read into numerous reads, whenever we encounter an excluded address.
+             * Split the read into numerous reads, one for each gap between the excluded address ranges.
              *
              * All values for bytes located at excluded addresses will be returned as 0x00 - this mirrors the behaviour
              * of the masked read memory EDBG command.
@@ -1566,13 +2100,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             auto segmentStartAddress = startAddress;
             const auto endAddress = startAddress + bytes - 1;
 
-            for (const auto excludedAddress : excludedAddresses) {
-                if (excludedAddress < startAddress || excludedAddress > endAddress) {
-                    // This excluded address is outside of the range from which we are reading, so it can be ignored.
-                    continue;
-                }
-
-                const auto segmentSize = excludedAddress - segmentStartAddress;
+            for (const auto& excludedRange : excludedAddressRanges) {
+                const auto segmentSize = excludedRange.startAddress - segmentStartAddress;
                 if (segmentSize > 0) {
                     auto segmentBuffer = this->readMemory(
                         type,
@@ -1583,14 +2112,14 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
                     std::move(segmentBuffer.begin(), segmentBuffer.end(), std::back_inserter(output));
                 }
 
-                output.emplace_back(0x00);
+                output.insert(output.end(), excludedRange.endAddress - excludedRange.startAddress + 1, 0x00);
 
-                segmentStartAddress = excludedAddress + 1;
+                segmentStartAddress = excludedRange.endAddress + 1;
             }
 
             // Read final segment
-            const auto finalReadBytes = (endAddress - segmentStartAddress) + 1;
-            if (finalReadBytes > 0) {
+            if (segmentStartAddress <= endAddress) {
+                const auto finalReadBytes = (endAddress - segmentStartAddress) + 1;
                 auto segmentBuffer = this->readMemory(
                     type,
                     segmentStartAddress,
@@ -1608,7 +2137,7 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             const auto alignedBytes = this->alignMemoryBytes(type, bytes + (startAddress - alignedStartAddress));
 
             if (alignedStartAddress != startAddress || alignedBytes != bytes) {
-                auto memoryBuffer = this->readMemory(type, alignedStartAddress, alignedBytes, excludedAddresses);
+                auto memoryBuffer = this->readMemory(type, alignedStartAddress, alignedBytes, excludedAddressRanges);
 
                 const auto offset = memoryBuffer.begin() + (startAddress - alignedStartAddress);
                 auto output = TargetMemoryBuffer();
@@ -1650,86 +2179,47 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         /*
          * Enforce a maximum memory access request size.
          *
-         * See the comment for EdbgAvr8Interface::setMaximumMemoryAccessSizePerRequest() for more on this.
+         * See the comment for EdbgAvr8Interface::setMaximumMemoryAccessSizePerRequest() and the implementation of
+         * EdbgAvr8Interface::getMaximumReadSize() for more on this.
          */
-        if (this->maximumMemoryAccessSizePerRequest.has_value() && bytes > this->maximumMemoryAccessSizePerRequest) {
-            auto maximumRequestSize = this->maximumMemoryAccessSizePerRequest.value();
-            auto totalReadsRequired = std::ceil(static_cast<float>(bytes) / static_cast<float>(maximumRequestSize));
-            auto output = std::vector<unsigned char>();
+        const auto maximumReadSize = this->getMaximumReadSize(type);
+        if (maximumReadSize.has_value() && bytes > maximumReadSize.value()) {
+            auto output = TargetMemoryBuffer();
             output.reserve(bytes);
 
-            for (float i = 1; i <= totalReadsRequired; i++) {
-                const auto bytesToRead = static_cast<std::uint32_t>(
-                    (bytes - output.size()) > maximumRequestSize ? maximumRequestSize : bytes - output.size()
+            while (output.size() < bytes) {
+                const auto bytesToRead = std::min(
+                    maximumReadSize.value(),
+                    static_cast<std::uint32_t>(bytes - output.size())
                 );
 
                 auto data = this->readMemory(
                     type,
                     static_cast<std::uint32_t>(startAddress + output.size()),
                     bytesToRead,
-                    excludedAddresses
+                    excludedAddressRanges
                 );
-                output.insert(output.end(), data.begin(), data.end());
+                std::move(data.begin(), data.end(), std::back_inserter(output));
             }
 
             return output;
         }
 
-        if (
-            type != Avr8MemoryType::FLASH_PAGE
-            && type != Avr8MemoryType::SPM
-            && type != Avr8MemoryType::APPL_FLASH
-            && type != Avr8MemoryType::BOOT_FLASH
-        ) {
-            /*
-             * EDBG AVR8 debug tools behave in a really weird way when responding with more than two packets
-             * for a single read (non-flash) memory command. The data they return in this case appears to be of little
-             * use.
-             *
-             * To address this, we make sure we only issue read memory commands that will result in no more than two
-             * response packets. For calls that require more than this, we simply split them into numerous calls.
-             */
-
-            /*
-             * The subtraction of 20 bytes here is just to account for any other bytes included in the response
-             * that isn't actually the memory data (like the command ID, version bytes, etc). I could have sought the
-             * actual value but who has the time. It won't exceed 20 bytes. Bite me.
-             */
-            auto singlePacketSize = static_cast<std::uint32_t>(this->edbgInterface.getUsbHidInputReportSize() - 20);
-            auto totalResponsePackets = std::ceil(static_cast<float>(bytes) / static_cast<float>(singlePacketSize));
-            auto totalReadsRequired = std::ceil(static_cast<float>(totalResponsePackets) / 2);
-
-            if (totalResponsePackets > 2) {
-                /*
-                 * This call to readMemory() will result in more than two response packets, so split it into multiple
-                 * calls that will result in no more than two response packets per call.
-                 */
-                auto output = std::vector<unsigned char>();
-
-                for (float i = 1; i <= totalReadsRequired; i++) {
-                    auto bytesToRead = static_cast<std::uint32_t>(
-                        (bytes - output.size()) > (singlePacketSize * 2) ? (singlePacketSize * 2)
-                        : bytes - output.size()
-                    );
-                    auto data = this->readMemory(
-                        type,
-                        static_cast<std::uint32_t>(startAddress + output.size()),
-                        bytesToRead,
-                        excludedAddresses
-                    );
-                    output.insert(output.end(), data.begin(), data.end());
-                }
-
-                return output;
-            }
-        }
+        return this->sendReadMemoryCommand(type, startAddress, bytes, excludedAddressRanges);
+    }
 
+    TargetMemoryBuffer EdbgAvr8Interface::sendReadMemoryCommand(
+        Avr8MemoryType type,
+        std::uint32_t startAddress,
+        std::uint32_t bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
         auto response = this->edbgInterface.sendAvrCommandFrameAndWaitForResponseFrame(
             ReadMemory(
                 type,
                 startAddress,
                 bytes,
-                excludedAddresses
+                excludedAddressRanges
             )
         );
 
@@ -3,10 +3,16 @@
 #include <cstdint>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
 #include <cassert>
 
 #include "src/DebugToolDrivers/TargetInterfaces/Microchip/AVR/AVR8/Avr8DebugInterface.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/Avr8Generic.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/MemoryReadPlanner.hpp"
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/MemoryAccessProfileCache.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/EdbgInterface.hpp"
 #include "src/Targets/Microchip/AVR/Target.hpp"
 #include "src/Targets/Microchip/AVR/AVR8/Family.hpp"
@@ -28,6 +34,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     public:
         explicit EdbgAvr8Interface(EdbgInterface& edbgInterface);
 
+        ~EdbgAvr8Interface() override;
+
         /**
          * Some EDBG devices don't seem to operate correctly when actioning the masked memory read EDBG command. The
          * data returned in response to the command appears to be completely incorrect.
@@ -187,6 +195,20 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         void clearBreakpoint(std::uint32_t address) override;
 
+        /**
+         * Issues a single "Software Breakpoint Set" command for all of the given byte addresses.
+         *
+         * @param addresses
+         */
+        void setBreakpoints(const std::vector<std::uint32_t>& addresses) override;
+
+        /**
+         * Issues a single "Software Breakpoint Clear" command for all of the given byte addresses.
+         *
+         * @param addresses
+         */
+        void clearBreakpoints(const std::vector<std::uint32_t>& addresses) override;
+
         /**
          * Issues the "Software Breakpoint Clear All" command to the debug tool, clearing all software breakpoints
          * that were set *in the current debug session*.
@@ -251,6 +273,22 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             std::optional<Targets::Microchip::Avr::Avr8Bit::ProgramMemorySection> section = std::nullopt
         ) override;
 
+        /**
+         * Page granular programming is supported for debugWire targets (the debug tool erases each flash page before
+         * writing to it) and PDI targets (via the application/boot page erase modes of the "Erase" command).
+         *
+         * @return
+         */
+        bool pageGranularProgrammingSupported() override;
+
+        /**
+         * Issues the "Erase" command to erase a single page of program memory. Does nothing for debugWire targets,
+         * as the debug tool erases flash pages implicitly.
+         *
+         * @param pageStartAddress
+         */
+        void eraseProgramMemoryPage(std::uint32_t pageStartAddress) override;
+
         /**
          * Returns the current state of the target.
          *
@@ -258,6 +296,17 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         Targets::TargetState getTargetState() override;
 
+        /**
+         * Starts the event reader thread, which will record a notification on the given notifier whenever the target
+         * stops of its own accord (upon hitting a breakpoint, for example).
+         *
+         * See EdbgAvr8Interface::readEvents() for more.
+         *
+         * @param notifier
+         * @return
+         */
+        bool setTargetStateChangeNotifier(NotifierInterface* notifier) override;
+
         /**
          * Enters programming mode on the EDBG debug tool.
          */
@@ -323,6 +372,24 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         std::optional<std::uint32_t> maximumMemoryAccessSizePerRequest;
 
+        /**
+         * Memory access profiles obtained via calibration, if enabled. See EdbgAvr8Interface::calibrateMemoryAccess().
+         */
+        MemoryAccessProfiles memoryAccessProfiles;
+
+        /**
+         * The maximum number of response packets we'll allow for a single read, during calibration.
+         *
+         * The fragment count of an AVR response is a 4-bit field, so a response frame cannot span more than 15
+         * packets. We leave some headroom for the non-data bytes in the response.
+         */
+        static constexpr std::uint32_t MAXIMUM_CALIBRATION_RESPONSE_PACKETS = 14;
+
+        /**
+         * The number of reads to average over, when measuring read latency during calibration.
+         */
+        static constexpr std::uint32_t CALIBRATION_TIMING_READS = 4;
+
         /**
          * We keep record of the current target state for caching purposes. We'll only refresh the target state if the
          * target is running. If it has already stopped, then we assume it cannot transition to a running state without
@@ -330,7 +397,36 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          *
          * @TODO: Review this. Is the above assumption correct? Always? Explore the option of polling the target state.
          */
-        Targets::TargetState targetState = Targets::TargetState::UNKNOWN;
+        std::atomic<Targets::TargetState> targetState = Targets::TargetState::UNKNOWN;
+
+        /**
+         * The event reader thread drains AVR events from the debug tool whilst the target is running. See
+         * EdbgAvr8Interface::readEvents().
+         */
+        std::thread eventReaderThread;
+        std::atomic<bool> eventReaderActive = false;
+        std::atomic<NotifierInterface*> targetStateChangeNotifier = nullptr;
+
+        /**
+         * Guards this->eventQueue and this->eventReaderStopRequested.
+         */
+        std::mutex eventMutex;
+        std::condition_variable eventCondition;
+        bool eventReaderStopRequested = false;
+
+        /**
+         * Events drained from the debug tool by the event reader thread, awaiting consumption via
+         * EdbgAvr8Interface::getAvrEvent().
+         */
+        std::deque<AvrEvent> eventQueue;
+
+        /**
+         * How long the event reader thread waits between event requests, when the debug tool has no events for us.
+         *
+         * This matches the interval at which the TargetController used to poll the target state, so the event
+         * reader generates no more USB traffic than the TargetController did.
+         */
+        static constexpr auto EVENT_POLL_INTERVAL = std::chrono::milliseconds(60);
 
         /**
          * Upon configuration, the physical interface must be activated on the debug tool. We keep record of this to
@@ -468,6 +564,9 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
         /**
          * Fetches any queued events belonging to the AVR8 Generic protocol (such as target break events).
          *
+         * Whilst the event reader thread is draining events from the debug tool, events are taken from
+         * this->eventQueue. Otherwise, they're requested from the debug tool directly.
+         *
          * @return
          */
         std::unique_ptr<AvrEvent> getAvrEvent();
@@ -477,6 +576,30 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          */
         void clearEvents();
 
+        /**
+         * Stops the event reader thread, if it's running.
+         */
+        void stopEventReader();
+
+        /**
+         * Wakes the event reader thread, so that it can begin draining events. Must be called whenever the target
+         * transitions to a running state.
+         */
+        void notifyEventReader();
+
+        /**
+         * Entry point for the event reader thread.
+         *
+         * EDBG tools don't push AVR events to the host - each event must be requested via an AVR_EVT command. So,
+         * whilst the target is running, this thread requests events from the debug tool, queues them for
+         * EdbgAvr8Interface::getAvrEvent(), and notifies this->targetStateChangeNotifier upon any break event. This
+         * relieves the TargetController from having to poll the target state.
+         *
+         * The thread sleeps whilst the target is stopped, or whilst there are queued events that have not been
+         * consumed.
+         */
+        void readEvents();
+
         /**
          * Checks if alignment is required for memory access via a given Avr8MemoryType.
          *
@@ -519,9 +642,10 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
          * @param bytes
          *  Number of bytes to access.
          *
-         * @param excludedAddresses
-         *  A set of addresses to exclude from the read operation. This is used to read memory ranges that could
-         *  involve accessing an illegal address, like the OCDDR address.
+         * @param excludedAddressRanges
+         *  Address ranges to exclude from the read operation. This is used to read memory ranges that could
+         *  involve accessing an illegal address, like the OCDDR address. Bytes within these ranges are returned as
+         *  0x00.
          *
          * @return
          */
@@ -529,7 +653,114 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
             Avr8MemoryType type,
             std::uint32_t startAddress,
             std::uint32_t bytes,
-            const std::set<std::uint32_t>& excludedAddresses = {}
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
+        );
+
+        /**
+         * Resolves the memory type to use when accessing registers of the given type.
+         *
+         * On XMEGA and UPDI targets, the general purpose registers are not mapped into the data address space, so
+         * they must be accessed via the REGISTER_FILE memory type.
+         *
+         * @param registerType
+         * @return
+         */
+        Avr8MemoryType getRegisterMemoryType(Targets::TargetRegisterType registerType);
+
+        /**
+         * Builds a cost model for reads of the given memory type, for use with the MemoryReadPlanner.
+         *
+         * The model is derived from the packet size of the debug tool, along with any alignment and size constraints
+         * that apply to the memory type. If the memory type has been calibrated, the measured latencies are used
+         * instead.
+         *
+         * @param memoryType
+         * @return
+         */
+        MemoryReadCostModel getReadCostModel(Avr8MemoryType memoryType);
+
+        /**
+         * Resolves the maximum number of bytes we will attempt to read in a single read memory command, for the given
+         * memory type.
+         *
+         * For non-flash memory types, this will be the calibrated maximum read size, if calibration has taken place.
+         * Otherwise, it will be the size of two response packets (see EdbgAvr8Interface::readMemory() for why).
+         * In all cases, it will not exceed this->maximumMemoryAccessSizePerRequest.
+         *
+         * @param memoryType
+         * @return
+         */
+        std::optional<std::uint32_t> getMaximumReadSize(Avr8MemoryType memoryType);
+
+        /**
+         * Probes the debug tool for the largest reliable read size and the read latency, for each non-flash memory
+         * type, and stores the results in this->memoryAccessProfiles.
+         *
+         * The results are cached per debug tool (serial number) and physical interface. If a cached profile exists,
+         * it will be used and no probing will take place.
+         *
+         * The target must be stopped.
+         */
+        void calibrateMemoryAccess();
+
+        /**
+         * Profiles reads of the given memory type, within the given memory region.
+         *
+         * Reads of increasing size are issued, and the data returned is compared against a reference copy of the
+         * region, obtained via reads that are known to be reliable. We stop at the first read that fails or returns
+         * incorrect data.
+         *
+         * @param memoryType
+         * @param regionStartAddress
+         * @param regionSize
+         *
+         * @return
+         *  The profile, or std::nullopt if the region is too small to profile.
+         */
+        std::optional<MemoryAccessProfile> profileMemoryAccess(
+            Avr8MemoryType memoryType,
+            std::uint32_t regionStartAddress,
+            std::uint32_t regionSize
+        );
+
+        /**
+         * Fetches the serial number of the debug tool, via the EDBG Discovery protocol.
+         *
+         * @return
+         */
+        std::string getToolSerialNumber();
+
+        /**
+         * Sends a single read memory command to the debug tool. No splitting or alignment takes place.
+         *
+         * @param type
+         * @param startAddress
+         * @param bytes
+         * @param excludedAddressRanges
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer sendReadMemoryCommand(
+            Avr8MemoryType type,
+            std::uint32_t startAddress,
+            std::uint32_t bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
+        );
+
+        /**
+         * Clips the given excluded address ranges to the given read range, merging any that overlap or adjoin.
+         * Ranges that fall outside of the read range are dropped.
+         *
+         * @param excludedAddressRanges
+         * @param startAddress
+         * @param endAddress
+         *
+         * @return
+         */
+        static std::set<Targets::TargetMemoryAddressRange> clipExcludedAddressRanges(
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges,
+            std::uint32_t startAddress,
+            std::uint32_t endAddress
         );
 
         /**
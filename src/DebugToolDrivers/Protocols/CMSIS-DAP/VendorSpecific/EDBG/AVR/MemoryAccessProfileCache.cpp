@@ -0,0 +1,123 @@
+#include "MemoryAccessProfileCache.hpp"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QJsonDocument>
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
+{
+    using namespace Bloom::Exceptions;
+
+    MemoryAccessProfileCache::MemoryAccessProfileCache(std::string filePath)
+        : filePath(std::move(filePath))
+    {}
+
+    std::optional<MemoryAccessProfiles> MemoryAccessProfileCache::get(
+        const std::string& serialNumber,
+        const std::string& physicalInterfaceName
+    ) const {
+        const auto cacheObj = this->load();
+        const auto toolObj = cacheObj.value(QString::fromStdString(serialNumber)).toObject();
+        const auto profilesObj = toolObj.value(QString::fromStdString(physicalInterfaceName)).toObject();
+
+        if (profilesObj.isEmpty()) {
+            return std::nullopt;
+        }
+
+        auto profiles = MemoryAccessProfiles();
+
+        for (auto profileIt = profilesObj.begin(); profileIt != profilesObj.end(); profileIt++) {
+            const auto memoryType = MemoryAccessProfileCache::memoryTypesByName.valueAt(profileIt.key());
+            const auto profileObj = profileIt.value().toObject();
+
+            if (
+                !memoryType.has_value()
+                || !profileObj.contains("maximumReadSize")
+                || !profileObj.contains("requestLatency")
+                || !profileObj.contains("byteLatency")
+            ) {
+                continue;
+            }
+
+            auto profile = MemoryAccessProfile();
+            profile.maximumReadSize = static_cast<std::uint32_t>(profileObj.value("maximumReadSize").toInteger());
+            profile.requestLatency = static_cast<std::uint32_t>(profileObj.value("requestLatency").toInteger());
+            profile.byteLatency = static_cast<std::uint32_t>(profileObj.value("byteLatency").toInteger());
+
+            if (profile.maximumReadSize == 0) {
+                continue;
+            }
+
+            profiles.insert(std::pair(memoryType.value(), profile));
+        }
+
+        if (profiles.empty()) {
+            return std::nullopt;
+        }
+
+        return profiles;
+    }
+
+    void MemoryAccessProfileCache::store(
+        const std::string& serialNumber,
+        const std::string& physicalInterfaceName,
+        const MemoryAccessProfiles& profiles
+    ) {
+        auto profilesObj = QJsonObject();
+
+        for (const auto& [memoryType, profile] : profiles) {
+            if (!MemoryAccessProfileCache::memoryTypesByName.contains(memoryType)) {
+                continue;
+            }
+
+            profilesObj.insert(MemoryAccessProfileCache::memoryTypesByName.at(memoryType), QJsonObject({
+                {"maximumReadSize", static_cast<qint64>(profile.maximumReadSize)},
+                {"requestLatency", static_cast<qint64>(profile.requestLatency)},
+                {"byteLatency", static_cast<qint64>(profile.byteLatency)},
+            }));
+        }
+
+        auto cacheObj = this->load();
+        const auto serialNumberKey = QString::fromStdString(serialNumber);
+
+        auto toolObj = cacheObj.value(serialNumberKey).toObject();
+        toolObj.insert(QString::fromStdString(physicalInterfaceName), profilesObj);
+        cacheObj.insert(serialNumberKey, toolObj);
+
+        const auto cacheFilePath = QString::fromStdString(this->filePath);
+        QDir().mkpath(QFileInfo(cacheFilePath).absolutePath());
+
+        auto cacheFile = QFile(cacheFilePath);
+        if (!cacheFile.open(QIODevice::ReadWrite | QIODevice::Truncate | QIODevice::Text)) {
+            throw Exception(
+                "Failed to open/create memory access profile cache file (" + this->filePath
+                    + "). Check file permissions."
+            );
+        }
+
+        cacheFile.write(QJsonDocument(cacheObj).toJson());
+        cacheFile.close();
+    }
+
+    QJsonObject MemoryAccessProfileCache::load() const {
+        auto cacheFile = QFile(QString::fromStdString(this->filePath));
+
+        if (!cacheFile.exists()) {
+            return {};
+        }
+
+        if (!cacheFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            Logger::warning("Failed to open memory access profile cache file (" + this->filePath + ")");
+            return {};
+        }
+
+        const auto cacheObj = QJsonDocument::fromJson(cacheFile.readAll()).object();
+        cacheFile.close();
+
+        return cacheObj;
+    }
+}
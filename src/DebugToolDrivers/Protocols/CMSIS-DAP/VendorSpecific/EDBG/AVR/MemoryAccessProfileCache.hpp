@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <optional>
+#include <QJsonObject>
+#include <QString>
+
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/Avr8Generic.hpp"
+#include "src/Helpers/BiMap.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
+{
+    /**
+     * Describes how a debug tool services reads of a single memory type, over a particular physical interface.
+     *
+     * Profiles are obtained by calibration - see EdbgAvr8Interface::calibrateMemoryAccess().
+     */
+    struct MemoryAccessProfile
+    {
+        /**
+         * The largest read, in bytes, that the debug tool serviced reliably.
+         */
+        std::uint32_t maximumReadSize = 0;
+
+        /**
+         * The fixed time taken to service a read command, regardless of its size, in microseconds.
+         */
+        std::uint32_t requestLatency = 0;
+
+        /**
+         * The time taken to read each byte, in nanoseconds.
+         */
+        std::uint32_t byteLatency = 0;
+    };
+
+    using MemoryAccessProfiles = std::map<Avr8MemoryType, MemoryAccessProfile>;
+
+    /**
+     * The MemoryAccessProfileCache persists memory access profiles in a JSON file, keyed by the serial number of the
+     * debug tool and the name of the physical interface. This means calibration only has to take place once, for
+     * each tool and interface.
+     */
+    class MemoryAccessProfileCache
+    {
+    public:
+        explicit MemoryAccessProfileCache(std::string filePath);
+
+        /**
+         * Retrieves the cached profiles for the given debug tool and physical interface.
+         *
+         * @param serialNumber
+         * @param physicalInterfaceName
+         *
+         * @return
+         *  The cached profiles, or std::nullopt if none have been cached.
+         */
+        [[nodiscard]] std::optional<MemoryAccessProfiles> get(
+            const std::string& serialNumber,
+            const std::string& physicalInterfaceName
+        ) const;
+
+        /**
+         * Stores profiles for the given debug tool and physical interface, replacing any that were previously
+         * cached. Profiles for other tools and interfaces are preserved.
+         *
+         * @param serialNumber
+         * @param physicalInterfaceName
+         * @param profiles
+         */
+        void store(
+            const std::string& serialNumber,
+            const std::string& physicalInterfaceName,
+            const MemoryAccessProfiles& profiles
+        );
+
+    private:
+        std::string filePath;
+
+        static const inline BiMap<Avr8MemoryType, QString> memoryTypesByName = {
+            {Avr8MemoryType::SRAM, "sram"},
+            {Avr8MemoryType::EEPROM, "eeprom"},
+        };
+
+        /**
+         * Loads the cache file. Returns an empty object if the file doesn't exist or cannot be parsed.
+         *
+         * @return
+         */
+        [[nodiscard]] QJsonObject load() const;
+    };
+}
@@ -0,0 +1,85 @@
+#include "MemoryReadPlanner.hpp"
+
+#include <algorithm>
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
+{
+    using Bloom::Targets::TargetMemoryAddressRange;
+
+    void MemoryReadPlanner::addRead(Avr8MemoryType memoryType, std::uint32_t startAddress, std::uint32_t bytes) {
+        if (bytes == 0) {
+            return;
+        }
+
+        this->addressRangesByMemoryType[memoryType].emplace_back(startAddress, startAddress + (bytes - 1));
+    }
+
+    std::map<Avr8MemoryType, std::vector<TargetMemoryAddressRange>> MemoryReadPlanner::plan(
+        const CostModelProvider& getCostModel
+    ) const {
+        auto output = std::map<Avr8MemoryType, std::vector<TargetMemoryAddressRange>>();
+
+        for (const auto& [memoryType, requestedRanges] : this->addressRangesByMemoryType) {
+            const auto costModel = getCostModel(memoryType);
+            const auto alignTo = std::max(costModel.alignTo, std::uint32_t(1));
+
+            auto addressRanges = std::vector<TargetMemoryAddressRange>();
+            addressRanges.reserve(requestedRanges.size());
+
+            for (const auto& requestedRange : requestedRanges) {
+                addressRanges.emplace_back(
+                    requestedRange.startAddress - (requestedRange.startAddress % alignTo),
+                    requestedRange.endAddress + (alignTo - 1) - (requestedRange.endAddress % alignTo)
+                );
+            }
+
+            std::sort(addressRanges.begin(), addressRanges.end());
+
+            /*
+             * We walk through the ranges in address order, extending the current read to cover the next range for as
+             * long as doing so is no more expensive than reading the next range separately.
+             *
+             * Ranges that overlap or adjoin the current read are always absorbed, as a single read of the union can
+             * never cost more than two reads.
+             */
+            auto& plannedRanges = output[memoryType];
+            auto currentRange = addressRanges.front();
+
+            for (auto rangeIt = std::next(addressRanges.begin()); rangeIt != addressRanges.end(); ++rangeIt) {
+                if (rangeIt->startAddress <= currentRange.endAddress + 1) {
+                    currentRange.endAddress = std::max(currentRange.endAddress, rangeIt->endAddress);
+                    continue;
+                }
+
+                const auto combinedRange = TargetMemoryAddressRange(currentRange.startAddress, rangeIt->endAddress);
+                if (
+                    MemoryReadPlanner::getReadCost(combinedRange, costModel)
+                    <= MemoryReadPlanner::getReadCost(currentRange, costModel)
+                        + MemoryReadPlanner::getReadCost(*rangeIt, costModel)
+                ) {
+                    currentRange = combinedRange;
+                    continue;
+                }
+
+                plannedRanges.push_back(currentRange);
+                currentRange = *rangeIt;
+            }
+
+            plannedRanges.push_back(currentRange);
+        }
+
+        return output;
+    }
+
+    std::uint64_t MemoryReadPlanner::getReadCost(
+        const TargetMemoryAddressRange& addressRange,
+        const MemoryReadCostModel& costModel
+    ) {
+        const auto bytes = static_cast<std::uint64_t>(addressRange.endAddress - addressRange.startAddress) + 1;
+        const auto requests = costModel.maximumReadSize.has_value() && costModel.maximumReadSize.value() > 0
+            ? (bytes + costModel.maximumReadSize.value() - 1) / costModel.maximumReadSize.value()
+            : 1;
+
+        return (requests * costModel.requestCost) + (bytes * costModel.byteCost);
+    }
+}
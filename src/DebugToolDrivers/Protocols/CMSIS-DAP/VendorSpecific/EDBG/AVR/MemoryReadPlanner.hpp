@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include <optional>
+#include <functional>
+
+#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/Avr8Generic.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
+{
+    /**
+     * Describes the cost of reading memory from the target, via a particular debug tool.
+     *
+     * The costs are in arbitrary units - only their ratio matters.
+     */
+    struct MemoryReadCostModel
+    {
+        /**
+         * The fixed cost of issuing a single read command, regardless of its size.
+         */
+        std::uint32_t requestCost = 1;
+
+        /**
+         * The cost of reading a single byte.
+         */
+        std::uint32_t byteCost = 0;
+
+        /**
+         * The start address and size of each read must be aligned to this value.
+         */
+        std::uint32_t alignTo = 1;
+
+        /**
+         * The maximum number of bytes that can be read with a single command. Larger reads will be split into
+         * multiple commands, each incurring this->requestCost.
+         */
+        std::optional<std::uint32_t> maximumReadSize;
+    };
+
+    /**
+     * The MemoryReadPlanner takes a collection of scattered memory reads and produces the cheapest set of reads that
+     * will cover them all, according to a MemoryReadCostModel.
+     *
+     * Overlapping and adjacent reads are always combined. Reads separated by a gap are combined when reading the gap
+     * costs less than issuing another command.
+     *
+     * Usage:
+     *   auto planner = MemoryReadPlanner();
+     *   planner.addRead(Avr8MemoryType::SRAM, 0x20, 1);
+     *   planner.addRead(Avr8MemoryType::SRAM, 0x25, 2);
+     *
+     *   for (const auto& [memoryType, addressRanges] : planner.plan(getCostModel)) {
+     *       ...
+     *   }
+     */
+    class MemoryReadPlanner
+    {
+    public:
+        using CostModelProvider = std::function<MemoryReadCostModel(Avr8MemoryType)>;
+
+        /**
+         * Records a read to be included in the plan.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param bytes
+         */
+        void addRead(Avr8MemoryType memoryType, std::uint32_t startAddress, std::uint32_t bytes);
+
+        /**
+         * Produces the reads required to cover all recorded reads.
+         *
+         * @param getCostModel
+         *  Will be called once for each memory type, to obtain the cost model for reads of that type.
+         *
+         * @return
+         *  The address ranges to read, mapped by memory type. The address ranges for each memory type are ordered by
+         *  start address, and do not overlap.
+         */
+        [[nodiscard]] std::map<Avr8MemoryType, std::vector<Targets::TargetMemoryAddressRange>> plan(
+            const CostModelProvider& getCostModel
+        ) const;
+
+    private:
+        std::map<Avr8MemoryType, std::vector<Targets::TargetMemoryAddressRange>> addressRangesByMemoryType;
+
+        /**
+         * Calculates the cost of reading the given address range, in a single call to the debug interface.
+         *
+         * @param addressRange
+         * @param costModel
+         *
+         * @return
+         */
+        static std::uint64_t getReadCost(
+            const Targets::TargetMemoryAddressRange& addressRange,
+            const MemoryReadCostModel& costModel
+        );
+    };
+}
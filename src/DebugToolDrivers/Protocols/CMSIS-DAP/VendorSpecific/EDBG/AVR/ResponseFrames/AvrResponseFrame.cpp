@@ -7,15 +7,39 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg::Avr
     using namespace Bloom::Exceptions;
 
     void AvrResponseFrame::initFromAvrResponses(const std::vector<AvrResponse>& avrResponses) {
-        // Build a raw frame buffer from the AvrResponse objects and just call initFromRawFrame()
-        std::vector<unsigned char> rawFrame;
+        /*
+         * The response packets are appended straight into the payload, which is allocated once. The frame header
+         * (which will occupy the first four bytes of the payload) is then validated and stripped in place.
+         */
+        auto frameSize = std::size_t(0);
+        for (const auto& avrResponse : avrResponses) {
+            frameSize += avrResponse.getResponsePacket().size();
+        }
+
+        auto& payload = this->getPayload();
+        payload.clear();
+        payload.reserve(frameSize);
 
         for (const auto& avrResponse : avrResponses) {
-            auto responsePacket = avrResponse.getResponsePacket();
-            rawFrame.insert(rawFrame.end(), responsePacket.begin(), responsePacket.end());
+            const auto responsePacket = avrResponse.getResponsePacket();
+            payload.insert(payload.end(), responsePacket.begin(), responsePacket.end());
+        }
+
+        if (payload.size() < 4) {
+            // All AVR response frames must consist of at least four bytes (SOF, sequence ID (two bytes) and
+            // a protocol handler ID)
+            throw Exception("Failed to construct AvrResponseFrame - unexpected end to raw frame");
         }
 
-        return this->initFromRawFrame(rawFrame);
+        if (payload[0] != 0x0E) {
+            // The SOF field must always be 0x0E
+            throw Exception("Failed to construct AvrResponseFrame - unexpected SOF field value in raw frame");
+        }
+
+        this->setSequenceId(static_cast<std::uint16_t>((payload[2] << 8) + payload[1]));
+        this->setProtocolHandlerId(payload[3]);
+
+        payload.erase(payload.begin(), payload.begin() + 4);
     }
 
     void AvrResponseFrame::initFromRawFrame(const std::vector<unsigned char>& rawFrame) {
@@ -0,0 +1,16 @@
+#include "EdbgDebugToolConfig.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
+{
+    EdbgDebugToolConfig::EdbgDebugToolConfig(const DebugToolConfig& debugToolConfig)
+        : DebugToolConfig(debugToolConfig)
+    {
+        if (debugToolConfig.jsonObject.contains("pipelineAvrCommands")) {
+            this->pipelineAvrCommands = debugToolConfig.jsonObject.value("pipelineAvrCommands").toBool();
+        }
+
+        if (debugToolConfig.jsonObject.contains("asyncHidTransfers")) {
+            this->asyncHidTransfers = debugToolConfig.jsonObject.value("asyncHidTransfers").toBool();
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "src/ProjectConfig.hpp"
+
+namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
+{
+    /**
+     * Extending the generic DebugToolConfig struct to accommodate configuration parameters for EDBG-based debug
+     * tools.
+     */
+    class EdbgDebugToolConfig: public DebugToolConfig
+    {
+    public:
+        /**
+         * Determines if multi-fragment AVR command frames should be pipelined. See
+         * EdbgInterface::setMaximumPendingCommands() for more.
+         *
+         * This parameter is optional, and the function is disabled by default. Users must explicitly enable it in
+         * their debug tool configuration.
+         */
+        bool pipelineAvrCommands = false;
+
+        /**
+         * Determines if the HID interface should be serviced via libusb's asynchronous transfer API, as opposed to
+         * HIDAPI. See HidInterface::setAsyncTransfersEnabled() for more.
+         *
+         * This parameter is optional, and the function is disabled by default.
+         */
+        bool asyncHidTransfers = false;
+
+        explicit EdbgDebugToolConfig(const DebugToolConfig& debugToolConfig);
+    };
+}
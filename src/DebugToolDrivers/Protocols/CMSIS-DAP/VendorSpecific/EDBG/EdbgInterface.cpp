@@ -3,30 +3,37 @@
 #include <memory>
 
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+#include "src/Exceptions/Exception.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
 {
     using namespace Bloom::Exceptions;
 
     Protocols::CmsisDap::Response EdbgInterface::sendAvrCommandsAndWaitForResponse(
-        const std::vector<Avr::AvrCommand>& avrCommands
+        std::size_t commandCount,
+        const AvrCommandWriter& writeAvrCommand
     ) {
-        for (const auto& avrCommand : avrCommands) {
-            // Send command to device
-            auto response = this->sendCommandAndWaitForResponse(avrCommand);
+        if (commandCount < 1) {
+            throw DeviceCommunicationFailure(
+                "Cannot send AVR command frame - failed to generate CMSIS-DAP Vendor (AVR) commands"
+            );
+        }
 
-            if (&avrCommand == &avrCommands.back()) {
-                return response;
-            }
+        if (this->maximumPendingCommands > 1 && commandCount > 1) {
+            return this->sendAvrCommandsPipelined(commandCount, writeAvrCommand);
         }
 
-        // This should never happen
-        throw DeviceCommunicationFailure(
-            "Cannot send AVR command frame - failed to generate CMSIS-DAP Vendor (AVR) commands"
-        );
+        for (auto fragmentNumber = std::size_t(1); fragmentNumber < commandCount; ++fragmentNumber) {
+            this->sendCommandPacket(writeAvrCommand(fragmentNumber, this->getCommandPacketBuffer()));
+            this->getAvrCommandAcknowledgement();
+        }
+
+        this->sendCommandPacket(writeAvrCommand(commandCount, this->getCommandPacketBuffer()));
+        return this->getAvrCommandAcknowledgement();
     }
 
     std::optional<Protocols::CmsisDap::Edbg::Avr::AvrEvent> EdbgInterface::requestAvrEvent() {
+        const auto lock = std::unique_lock(this->exchangeMutex);
         auto avrEventResponse = this->sendCommandAndWaitForResponse(Avr::AvrEventCommand());
 
         if (avrEventResponse.getResponseId() != 0x82) {
@@ -43,8 +50,13 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
         AvrResponseCommand responseCommand;
 
         auto avrResponse = this->sendCommandAndWaitForResponse(responseCommand);
-        responses.push_back(avrResponse);
         const auto fragmentCount = avrResponse.getFragmentCount();
+        responses.push_back(std::move(avrResponse));
+
+        if (this->maximumPendingCommands > 1 && fragmentCount > 1) {
+            this->requestRemainingAvrResponsesPipelined(responses);
+            return responses;
+        }
 
         while (responses.size() < fragmentCount) {
             // There are more response packets
@@ -67,9 +79,137 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
                 break;
             }
 
-            responses.push_back(avrResponse);
+            responses.push_back(std::move(avrResponse));
         }
 
         return responses;
     }
+
+    Protocols::CmsisDap::Response EdbgInterface::sendAvrCommandsPipelined(
+        std::size_t commandCount,
+        const AvrCommandWriter& writeAvrCommand
+    ) {
+        /*
+         * The debug tool acknowledges each fragment in the order it was received, so we can send several fragments
+         * before collecting their acknowledgements. Only the first fragment is subject to the minimum command time
+         * gap.
+         *
+         * Each fragment is serialised into the command packet buffer just before it's sent, so the buffer can be
+         * reused for every fragment.
+         */
+        auto response = std::optional<Protocols::CmsisDap::Response>();
+        auto pendingCommands = std::size_t(0);
+
+        try {
+            for (auto fragmentNumber = std::size_t(1); fragmentNumber <= commandCount; ++fragmentNumber) {
+                if (pendingCommands >= this->maximumPendingCommands) {
+                    response = this->getPipelinedResponse<Protocols::CmsisDap::Response>();
+                    pendingCommands--;
+                    EdbgInterface::validateAvrCommandAcknowledgement(*response);
+                }
+
+                this->sendCommandPacket(
+                    writeAvrCommand(fragmentNumber, this->getCommandPacketBuffer()),
+                    fragmentNumber == 1
+                );
+                pendingCommands++;
+            }
+
+            while (pendingCommands > 0) {
+                response = this->getPipelinedResponse<Protocols::CmsisDap::Response>();
+                pendingCommands--;
+                EdbgInterface::validateAvrCommandAcknowledgement(*response);
+            }
+
+        } catch (const Exception& exception) {
+            this->discardPipelinedResponses(pendingCommands);
+            throw;
+        }
+
+        return *response;
+    }
+
+    Protocols::CmsisDap::Response EdbgInterface::getAvrCommandAcknowledgement() {
+        auto response = this->getResponse<Protocols::CmsisDap::Response>();
+        EdbgInterface::validateAvrCommandAcknowledgement(response);
+        return response;
+    }
+
+    void EdbgInterface::validateAvrCommandAcknowledgement(const Protocols::CmsisDap::Response& response) {
+        if (response.getResponseId() != 0x80) {
+            throw DeviceCommunicationFailure("Unexpected response to CMSIS-DAP command.");
+        }
+    }
+
+    void EdbgInterface::discardPipelinedResponses(std::size_t responseCount) {
+        for (; responseCount > 0; --responseCount) {
+            try {
+                this->getPipelinedResponse<Protocols::CmsisDap::Response>();
+
+            } catch (const Exception& exception) {
+                return;
+            }
+        }
+    }
+
+    void EdbgInterface::requestRemainingAvrResponsesPipelined(
+        std::vector<Protocols::CmsisDap::Edbg::Avr::AvrResponse>& responses
+    ) {
+        using Protocols::CmsisDap::Edbg::Avr::AvrResponse;
+        using Protocols::CmsisDap::Edbg::Avr::AvrResponseCommand;
+
+        const auto responseCommand = AvrResponseCommand();
+        const auto fragmentCount = responses.front().getFragmentCount();
+
+        auto requestedFragments = responses.size();
+        auto pendingRequests = std::size_t(0);
+        auto endOfResponse = false;
+
+        try {
+            while (requestedFragments < fragmentCount || pendingRequests > 0) {
+                while (requestedFragments < fragmentCount && pendingRequests < this->maximumPendingCommands) {
+                    this->sendCommandWithoutTimeGap(responseCommand);
+                    requestedFragments++;
+                    pendingRequests++;
+                }
+
+                auto avrResponse = this->getPipelinedResponse<AvrResponse>();
+                pendingRequests--;
+
+                if (avrResponse.getResponseId() != responseCommand.getCommandId()) {
+                    throw DeviceCommunicationFailure("Unexpected response to CMSIS-DAP command.");
+                }
+
+                if (endOfResponse) {
+                    // We've reached the end of the response data - we're just draining the remaining requests
+                    continue;
+                }
+
+                if (avrResponse.getFragmentCount() != fragmentCount) {
+                    throw DeviceCommunicationFailure(
+                        "Failed to fetch AvrResponse objects - invalid fragment count returned."
+                    );
+                }
+
+                if (avrResponse.getFragmentCount() == 0 && avrResponse.getFragmentNumber() == 0) {
+                    throw DeviceCommunicationFailure(
+                        "Failed to fetch AvrResponse objects - unexpected empty response"
+                    );
+                }
+
+                if (avrResponse.getFragmentNumber() == 0) {
+                    // End of response data - stop requesting fragments (this packet can be ignored)
+                    endOfResponse = true;
+                    requestedFragments = fragmentCount;
+                    continue;
+                }
+
+                responses.push_back(std::move(avrResponse));
+            }
+
+        } catch (const Exception& exception) {
+            this->discardPipelinedResponses(pendingRequests);
+            throw;
+        }
+    }
 }
@@ -1,16 +1,17 @@
 #pragma once
 
 #include <memory>
+#include <algorithm>
+#include <functional>
+#include <mutex>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/CmsisDapInterface.hpp"
-#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrCommand.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrResponse.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrEventCommand.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrEvent.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AvrCommandFrame.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/AvrResponseCommand.hpp"
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/ResponseFrames/AvrResponseFrame.hpp"
-#include "src/DebugToolDrivers/Protocols/CMSIS-DAP/VendorSpecific/EDBG/AVR/CommandFrames/AvrCommandFrame.hpp"
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
 
 namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
@@ -18,12 +19,41 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
     /**
      * The EdbgInterface class implements the EDBG sub-protocol, which takes the form of numerous CMSIS-DAP vendor
      * commands.
+     *
+     * AVR command/response exchanges and AVR event requests are serialised, so they can be issued from more than
+     * one thread (see EdbgAvr8Interface's event reader thread).
      */
     class EdbgInterface: public CmsisDapInterface
     {
     public:
         explicit EdbgInterface() = default;
 
+        /**
+         * Sets the maximum number of CMSIS-DAP commands that can be in flight at any one time, when sending AVR
+         * command frames and requesting AVR response frames.
+         *
+         * With a value of 1 (the default), each fragment of an AVR command frame is sent in lockstep - we wait for
+         * the debug tool to acknowledge one fragment before sending the next, and we request response fragments
+         * one at a time. Every fragment costs a full USB round trip.
+         *
+         * With a value above 1, we keep up to that many fragments in flight, and stream the response fragments
+         * back. This saves a USB round trip per fragment, which makes a big difference when writing large frames
+         * (flash pages, EEPROM, etc). In this mode, the minimum command time gap (see
+         * CmsisDapInterface::setMinimumCommandTimeGap()) is only enforced for the first fragment of each exchange.
+         *
+         * It's not known whether every debug tool copes with this - those that require a minimum command time gap
+         * may not. For this reason, debug tool drivers should only enable it when the user has opted in (see
+         * EdbgDebugToolConfig::pipelineAvrCommands).
+         *
+         * If an exchange fails part way through, any responses that are still in flight are read and discarded
+         * before the failure is reported, so that they're not mistaken for responses to later commands.
+         *
+         * @param maximumPendingCommands
+         */
+        void setMaximumPendingCommands(std::size_t maximumPendingCommands) {
+            this->maximumPendingCommands = std::max(maximumPendingCommands, std::size_t(1));
+        }
+
         /**
          * Send an AvrCommandFrame to the debug tool and wait for a response.
          *
@@ -40,13 +70,37 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
         ) {
             // An AVR command frame can be split into multiple CMSIS-DAP commands. Each command
             // containing a fragment of the AvrCommandFrame.
-            return this->sendAvrCommandsAndWaitForResponse(avrCommandFrame.generateAvrCommands(
-                this->getUsbHidInputReportSize() - 4 // Minus 4 to accommodate AVR command bytes
-            ));
+            const auto lock = std::unique_lock(this->exchangeMutex);
+            const auto maximumCommandPacketSize = this->getPacketSize() - 4; // Minus 4 for the AVR command fields
+
+            return this->sendAvrCommandsAndWaitForResponse(
+                avrCommandFrame.getAvrCommandCount(maximumCommandPacketSize),
+                [&avrCommandFrame, maximumCommandPacketSize] (std::size_t fragmentNumber, unsigned char* buffer) {
+                    return avrCommandFrame.writeAvrCommand(fragmentNumber, maximumCommandPacketSize, buffer);
+                }
+            );
         }
 
+        /**
+         * Serialises an AVR command into the given buffer, returning the number of bytes written.
+         *
+         * See AvrCommandFrame::writeAvrCommand().
+         */
+        using AvrCommandWriter = std::function<std::size_t(std::size_t fragmentNumber, unsigned char* buffer)>;
+
+        /**
+         * Sends a sequence of AVR commands, each of which is serialised directly into the command packet buffer
+         * (see CmsisDapInterface::getCommandPacketBuffer()), immediately before it's sent.
+         *
+         * @param commandCount
+         * @param writeAvrCommand
+         *
+         * @return
+         *  The acknowledgement of the final AVR command.
+         */
         virtual Protocols::CmsisDap::Response sendAvrCommandsAndWaitForResponse(
-            const std::vector<Avr::AvrCommand>& avrCommands
+            std::size_t commandCount,
+            const AvrCommandWriter& writeAvrCommand
         );
 
         template<class CommandFrameType>
@@ -61,6 +115,8 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
                 "AVR Command must specify a valid response frame type, derived from AvrResponseFrame."
             );
 
+            // The lock must be held across the command and response frames, as they form a single exchange
+            const auto lock = std::unique_lock(this->exchangeMutex);
             auto response = this->sendAvrCommandFrameAndWaitForResponse(avrCommandFrame);
 
             if (response.getData()[0] != 0x01) {
@@ -79,6 +135,67 @@ namespace Bloom::DebugToolDrivers::Protocols::CmsisDap::Edbg
         virtual std::optional<Protocols::CmsisDap::Edbg::Avr::AvrEvent> requestAvrEvent();
 
     private:
+        /**
+         * Guards AVR command/response exchanges and AVR event requests. This is recursive because the exchange
+         * functions call one another.
+         */
+        std::recursive_mutex exchangeMutex;
+
+        /**
+         * See EdbgInterface::setMaximumPendingCommands().
+         */
+        std::size_t maximumPendingCommands = 1;
+
         virtual std::vector<Protocols::CmsisDap::Edbg::Avr::AvrResponse> requestAvrResponses();
+
+        /**
+         * Sends the given AVR commands without waiting for each to be acknowledged, keeping up to
+         * this->maximumPendingCommands in flight.
+         *
+         * @param commandCount
+         * @param writeAvrCommand
+         *
+         * @return
+         *  The acknowledgement of the final AVR command.
+         */
+        Protocols::CmsisDap::Response sendAvrCommandsPipelined(
+            std::size_t commandCount,
+            const AvrCommandWriter& writeAvrCommand
+        );
+
+        /**
+         * Waits for the acknowledgement of an AVR command.
+         *
+         * @return
+         */
+        Protocols::CmsisDap::Response getAvrCommandAcknowledgement();
+
+        /**
+         * Checks that the given response is an acknowledgement of an AVR command.
+         *
+         * @param response
+         */
+        static void validateAvrCommandAcknowledgement(const Protocols::CmsisDap::Response& response);
+
+        /**
+         * Reads and discards the given number of pipelined responses. Used to recover from a failure part way
+         * through a pipelined exchange.
+         *
+         * Any failure to read a response is taken to mean that there are no more responses to read.
+         *
+         * @param responseCount
+         */
+        void discardPipelinedResponses(std::size_t responseCount);
+
+        /**
+         * Requests the remaining fragments of an AVR response, keeping up to this->maximumPendingCommands requests
+         * in flight.
+         *
+         * @param responses
+         *  The response fragments received so far. Must contain at least the first fragment.
+         */
+        void requestRemainingAvrResponsesPipelined(
+            std::vector<Protocols::CmsisDap::Edbg::Avr::AvrResponse>& responses
+        );
     };
 }
@@ -0,0 +1,796 @@
+#include "Avr8Core.hpp"
+
+#include <algorithm>
+#include <QString>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::DebugToolDrivers::Simulation::Avr
+{
+    using namespace Bloom::Exceptions;
+
+    using Targets::TargetMemoryBuffer;
+
+    Avr8Core::Avr8Core(const Targets::Microchip::Avr::Avr8Bit::TargetParameters& targetParameters) {
+        if (
+            !targetParameters.flashSize.has_value()
+            || !targetParameters.ramStartAddress.has_value()
+            || !targetParameters.ramSize.has_value()
+            || targetParameters.flashSize.value() < 2
+        ) {
+            throw Exception("Missing program memory/RAM target parameters - cannot simulate target");
+        }
+
+        if (targetParameters.mappedIoSegmentStartAddress.has_value()) {
+            this->ioStartAddress = targetParameters.mappedIoSegmentStartAddress.value();
+        }
+
+        this->registersMapped = this->ioStartAddress >= this->registers.size();
+
+        if (targetParameters.statusRegisterStartAddress.has_value()) {
+            this->statusRegisterAddress = targetParameters.statusRegisterStartAddress.value();
+        }
+
+        if (targetParameters.stackPointerRegisterLowAddress.has_value()) {
+            this->stackPointerAddress = targetParameters.stackPointerRegisterLowAddress.value();
+        }
+
+        if (targetParameters.stackPointerRegisterSize.has_value()) {
+            this->stackPointerSize = std::clamp(
+                static_cast<std::uint32_t>(targetParameters.stackPointerRegisterSize.value()),
+                std::uint32_t(1),
+                std::uint32_t(2)
+            );
+        }
+
+        this->ramEndAddress = targetParameters.ramStartAddress.value() + targetParameters.ramSize.value() - 1;
+        this->programCounterSize = targetParameters.flashSize.value() > 0x20000 ? 3 : 2;
+
+        this->flash = TargetMemoryBuffer(targetParameters.flashSize.value(), 0xFF);
+        this->eeprom = TargetMemoryBuffer(targetParameters.eepromSize.value_or(0), 0xFF);
+        this->dataMemory = TargetMemoryBuffer(
+            std::max({
+                this->ramEndAddress + 1,
+                this->statusRegisterAddress + 1,
+                this->stackPointerAddress + this->stackPointerSize,
+            }),
+            0x00
+        );
+
+        this->reset();
+    }
+
+    void Avr8Core::reset() {
+        this->registers.fill(0x00);
+        this->programCounter = 0;
+        this->dataMemory[this->statusRegisterAddress] = 0x00;
+        this->setStackPointer(this->ramEndAddress);
+    }
+
+    Avr8Core::StepResult Avr8Core::step() {
+        const auto opcode = this->fetchWord(this->programCounter);
+        const auto breakInstruction = opcode == 0x9598;
+
+        this->programCounter = (breakInstruction ? this->programCounter + 1 : this->execute(opcode))
+            % this->getFlashWordCount();
+        this->instructionCount++;
+
+        return breakInstruction ? StepResult::BREAK : StepResult::EXECUTED;
+    }
+
+    std::uint8_t Avr8Core::readData(std::uint32_t address) const {
+        if (this->registersMapped && address < this->registers.size()) {
+            return this->registers[address];
+        }
+
+        return address < this->dataMemory.size() ? this->dataMemory[address] : 0x00;
+    }
+
+    void Avr8Core::writeData(std::uint32_t address, std::uint8_t value) {
+        if (this->registersMapped && address < this->registers.size()) {
+            this->registers[address] = value;
+            return;
+        }
+
+        if (address < this->dataMemory.size()) {
+            this->dataMemory[address] = value;
+        }
+    }
+
+    std::uint16_t Avr8Core::fetchWord(std::uint32_t wordAddress) const {
+        const auto byteAddress = (wordAddress % this->getFlashWordCount()) * 2;
+        return static_cast<std::uint16_t>(this->flash[byteAddress] | (this->flash[byteAddress + 1] << 8));
+    }
+
+    bool Avr8Core::isTwoWordInstruction(std::uint32_t wordAddress) const {
+        const auto opcode = this->fetchWord(wordAddress);
+
+        return (opcode & 0xFE0C) == 0x940C // JMP/CALL
+            || (opcode & 0xFC0F) == 0x9000; // LDS/STS
+    }
+
+    bool Avr8Core::getFlag(StatusRegisterBit bit) const {
+        return (this->dataMemory[this->statusRegisterAddress] >> bit) & 0x01;
+    }
+
+    void Avr8Core::setFlag(StatusRegisterBit bit, bool value) {
+        auto& statusRegister = this->dataMemory[this->statusRegisterAddress];
+        statusRegister = static_cast<std::uint8_t>(
+            value ? (statusRegister | (0x01 << bit)) : (statusRegister & ~(0x01 << bit))
+        );
+    }
+
+    void Avr8Core::setResultFlags(std::uint8_t result) {
+        this->setFlag(StatusRegisterBit::NEGATIVE, (result & 0x80) != 0);
+        this->setFlag(StatusRegisterBit::ZERO, result == 0);
+        this->setFlag(
+            StatusRegisterBit::SIGN,
+            this->getFlag(StatusRegisterBit::NEGATIVE) != this->getFlag(StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW)
+        );
+    }
+
+    std::uint16_t Avr8Core::readRegisterPair(std::uint8_t lowRegisterNumber) const {
+        return static_cast<std::uint16_t>(
+            this->registers[lowRegisterNumber] | (this->registers[lowRegisterNumber + 1] << 8)
+        );
+    }
+
+    void Avr8Core::writeRegisterPair(std::uint8_t lowRegisterNumber, std::uint16_t value) {
+        this->registers[lowRegisterNumber] = static_cast<std::uint8_t>(value);
+        this->registers[lowRegisterNumber + 1] = static_cast<std::uint8_t>(value >> 8);
+    }
+
+    std::uint32_t Avr8Core::getStackPointer() const {
+        auto stackPointer = static_cast<std::uint32_t>(this->dataMemory[this->stackPointerAddress]);
+
+        if (this->stackPointerSize > 1) {
+            stackPointer |= static_cast<std::uint32_t>(this->dataMemory[this->stackPointerAddress + 1] << 8);
+        }
+
+        return stackPointer;
+    }
+
+    void Avr8Core::setStackPointer(std::uint32_t stackPointer) {
+        this->dataMemory[this->stackPointerAddress] = static_cast<std::uint8_t>(stackPointer);
+
+        if (this->stackPointerSize > 1) {
+            this->dataMemory[this->stackPointerAddress + 1] = static_cast<std::uint8_t>(stackPointer >> 8);
+        }
+    }
+
+    void Avr8Core::push(std::uint8_t value) {
+        const auto stackPointer = this->getStackPointer();
+        this->writeData(stackPointer, value);
+        this->setStackPointer(stackPointer - 1);
+    }
+
+    std::uint8_t Avr8Core::pop() {
+        const auto stackPointer = this->getStackPointer() + 1;
+        this->setStackPointer(stackPointer);
+        return this->readData(stackPointer);
+    }
+
+    void Avr8Core::pushProgramCounter(std::uint32_t returnAddress) {
+        // The return address is pushed LSB first, leaving it in MSB form on the stack
+        for (auto i = std::uint8_t(0); i < this->programCounterSize; i++) {
+            this->push(static_cast<std::uint8_t>(returnAddress >> (i * 8)));
+        }
+    }
+
+    std::uint32_t Avr8Core::popProgramCounter() {
+        auto returnAddress = std::uint32_t(0);
+
+        for (auto i = std::uint8_t(0); i < this->programCounterSize; i++) {
+            returnAddress = (returnAddress << 8) | this->pop();
+        }
+
+        return returnAddress;
+    }
+
+    std::uint8_t Avr8Core::add(std::uint8_t left, std::uint8_t right, bool carry) {
+        const auto result = static_cast<std::uint8_t>(left + right + (carry ? 1 : 0));
+        const auto carryBits = static_cast<std::uint8_t>((left & right) | (right & ~result) | (~result & left));
+
+        this->setFlag(StatusRegisterBit::HALF_CARRY, (carryBits & 0x08) != 0);
+        this->setFlag(StatusRegisterBit::CARRY, (carryBits & 0x80) != 0);
+        this->setFlag(
+            StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW,
+            (((left & right & ~result) | (~left & ~right & result)) & 0x80) != 0
+        );
+        this->setResultFlags(result);
+
+        return result;
+    }
+
+    std::uint8_t Avr8Core::subtract(std::uint8_t left, std::uint8_t right, bool carry, bool keepZero) {
+        const auto result = static_cast<std::uint8_t>(left - right - (carry ? 1 : 0));
+        const auto borrowBits = static_cast<std::uint8_t>((~left & right) | (right & result) | (result & ~left));
+        const auto previousZero = this->getFlag(StatusRegisterBit::ZERO);
+
+        this->setFlag(StatusRegisterBit::HALF_CARRY, (borrowBits & 0x08) != 0);
+        this->setFlag(StatusRegisterBit::CARRY, (borrowBits & 0x80) != 0);
+        this->setFlag(
+            StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW,
+            (((left & ~right & ~result) | (~left & right & result)) & 0x80) != 0
+        );
+        this->setResultFlags(result);
+
+        if (keepZero) {
+            // SBC, SBCI and CPC only ever clear the zero flag
+            this->setFlag(StatusRegisterBit::ZERO, result == 0 && previousZero);
+        }
+
+        return result;
+    }
+
+    void Avr8Core::multiply(std::int32_t left, std::int32_t right, bool fractional) {
+        const auto product = static_cast<std::uint32_t>(left * right) & 0xFFFF;
+        const auto result = static_cast<std::uint16_t>(fractional ? (product << 1) : product);
+
+        this->setFlag(StatusRegisterBit::CARRY, (product & 0x8000) != 0);
+        this->setFlag(StatusRegisterBit::ZERO, result == 0);
+        this->writeRegisterPair(0, result);
+    }
+
+    std::uint32_t Avr8Core::execute(std::uint16_t opcode) {
+        const auto nextAddress = this->programCounter + 1;
+
+        // Common operand encodings
+        const auto rd = static_cast<std::uint8_t>((opcode >> 4) & 0x1F);
+        const auto rr = static_cast<std::uint8_t>((opcode & 0x0F) | ((opcode >> 5) & 0x10));
+        const auto rdUpper = static_cast<std::uint8_t>(16 + ((opcode >> 4) & 0x0F));
+        const auto immediate = static_cast<std::uint8_t>((opcode & 0x0F) | ((opcode >> 4) & 0xF0));
+        const auto bit = static_cast<std::uint8_t>(opcode & 0x07);
+
+        const auto unsupportedInstruction = [opcode] {
+            return Exception(
+                "Unsupported instruction (opcode: 0x" + QString::number(opcode, 16).toUpper().toStdString() + ")"
+            );
+        };
+
+        const auto skipNextInstruction = [this, nextAddress] (bool condition) {
+            if (!condition) {
+                return nextAddress;
+            }
+
+            return nextAddress + (this->isTwoWordInstruction(nextAddress) ? 2 : 1);
+        };
+
+        if (opcode == 0x0000) {
+            // NOP
+            return nextAddress;
+        }
+
+        switch (opcode & 0xFC00) {
+            case 0x0400: {
+                // CPC
+                this->subtract(this->registers[rd], this->registers[rr], this->getFlag(StatusRegisterBit::CARRY), true);
+                return nextAddress;
+            }
+            case 0x0800: {
+                // SBC
+                this->registers[rd] = this->subtract(
+                    this->registers[rd],
+                    this->registers[rr],
+                    this->getFlag(StatusRegisterBit::CARRY),
+                    true
+                );
+                return nextAddress;
+            }
+            case 0x0C00: {
+                // ADD (LSL)
+                this->registers[rd] = this->add(this->registers[rd], this->registers[rr], false);
+                return nextAddress;
+            }
+            case 0x1000: {
+                // CPSE
+                return skipNextInstruction(this->registers[rd] == this->registers[rr]);
+            }
+            case 0x1400: {
+                // CP
+                this->subtract(this->registers[rd], this->registers[rr], false, false);
+                return nextAddress;
+            }
+            case 0x1800: {
+                // SUB
+                this->registers[rd] = this->subtract(this->registers[rd], this->registers[rr], false, false);
+                return nextAddress;
+            }
+            case 0x1C00: {
+                // ADC (ROL)
+                this->registers[rd] = this->add(
+                    this->registers[rd],
+                    this->registers[rr],
+                    this->getFlag(StatusRegisterBit::CARRY)
+                );
+                return nextAddress;
+            }
+            case 0x2000:
+            case 0x2400:
+            case 0x2800: {
+                // AND, EOR, OR
+                const auto operation = opcode & 0xFC00;
+                const auto result = static_cast<std::uint8_t>(
+                    operation == 0x2000 ? (this->registers[rd] & this->registers[rr])
+                        : operation == 0x2400 ? (this->registers[rd] ^ this->registers[rr])
+                        : (this->registers[rd] | this->registers[rr])
+                );
+
+                this->registers[rd] = result;
+                this->setFlag(StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW, false);
+                this->setResultFlags(result);
+                return nextAddress;
+            }
+            case 0x2C00: {
+                // MOV
+                this->registers[rd] = this->registers[rr];
+                return nextAddress;
+            }
+            case 0x9C00: {
+                // MUL
+                this->multiply(this->registers[rd], this->registers[rr], false);
+                return nextAddress;
+            }
+            default: {
+                break;
+            }
+        }
+
+        switch (opcode & 0xF000) {
+            case 0x3000: {
+                // CPI
+                this->subtract(this->registers[rdUpper], immediate, false, false);
+                return nextAddress;
+            }
+            case 0x4000: {
+                // SBCI
+                this->registers[rdUpper] = this->subtract(
+                    this->registers[rdUpper],
+                    immediate,
+                    this->getFlag(StatusRegisterBit::CARRY),
+                    true
+                );
+                return nextAddress;
+            }
+            case 0x5000: {
+                // SUBI
+                this->registers[rdUpper] = this->subtract(this->registers[rdUpper], immediate, false, false);
+                return nextAddress;
+            }
+            case 0x6000:
+            case 0x7000: {
+                // ORI (SBR), ANDI (CBR)
+                const auto result = static_cast<std::uint8_t>(
+                    (opcode & 0xF000) == 0x6000
+                        ? (this->registers[rdUpper] | immediate)
+                        : (this->registers[rdUpper] & immediate)
+                );
+
+                this->registers[rdUpper] = result;
+                this->setFlag(StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW, false);
+                this->setResultFlags(result);
+                return nextAddress;
+            }
+            case 0xC000:
+            case 0xD000: {
+                // RJMP, RCALL
+                auto offset = static_cast<std::int32_t>(opcode & 0x0FFF);
+                if (offset & 0x0800) {
+                    offset -= 0x1000;
+                }
+
+                if ((opcode & 0xF000) == 0xD000) {
+                    this->pushProgramCounter(nextAddress);
+                }
+
+                return static_cast<std::uint32_t>(static_cast<std::int32_t>(nextAddress) + offset);
+            }
+            case 0xE000: {
+                // LDI (SER)
+                this->registers[rdUpper] = immediate;
+                return nextAddress;
+            }
+            default: {
+                break;
+            }
+        }
+
+        if ((opcode & 0xD000) == 0x8000) {
+            // LDD/STD (including LD/ST via Y and Z, without displacement)
+            const auto displacement = static_cast<std::uint32_t>(
+                (opcode & 0x07) | ((opcode >> 7) & 0x18) | ((opcode >> 8) & 0x20)
+            );
+            const auto pointer = this->readRegisterPair((opcode & 0x0008) ? 28 : 30);
+
+            if (opcode & 0x0200) {
+                this->writeData(pointer + displacement, this->registers[rd]);
+
+            } else {
+                this->registers[rd] = this->readData(pointer + displacement);
+            }
+
+            return nextAddress;
+        }
+
+        if ((opcode & 0xFC00) == 0x9000 || (opcode & 0xFC00) == 0x9200) {
+            const auto store = (opcode & 0x0200) != 0;
+
+            switch (opcode & 0x000F) {
+                case 0x0: {
+                    // LDS, STS
+                    const auto address = this->fetchWord(nextAddress);
+
+                    if (store) {
+                        this->writeData(address, this->registers[rd]);
+
+                    } else {
+                        this->registers[rd] = this->readData(address);
+                    }
+
+                    return nextAddress + 1;
+                }
+                case 0x1:
+                case 0x2:
+                case 0x9:
+                case 0xA:
+                case 0xC:
+                case 0xD:
+                case 0xE: {
+                    // LD/ST via X, Y or Z, with post-increment or pre-decrement
+                    const auto mode = opcode & 0x000F;
+                    const auto pointerRegister = std::uint8_t(mode >= 0xC ? 26 : (mode >= 0x9 ? 28 : 30));
+                    const auto postIncrement = mode == 0x1 || mode == 0x9 || mode == 0xD;
+                    const auto preDecrement = mode == 0x2 || mode == 0xA || mode == 0xE;
+
+                    auto pointer = this->readRegisterPair(pointerRegister);
+
+                    if (preDecrement) {
+                        pointer--;
+                    }
+
+                    if (store) {
+                        this->writeData(pointer, this->registers[rd]);
+
+                    } else {
+                        this->registers[rd] = this->readData(pointer);
+                    }
+
+                    if (postIncrement) {
+                        pointer++;
+                    }
+
+                    this->writeRegisterPair(pointerRegister, pointer);
+                    return nextAddress;
+                }
+                case 0x4:
+                case 0x5:
+                case 0x6:
+                case 0x7: {
+                    if (store) {
+                        // XCH, LAS, LAC and LAT are XMEGA-only
+                        break;
+                    }
+
+                    // LPM Rd, Z(+), ELPM Rd, Z(+)
+                    auto address = static_cast<std::uint32_t>(this->readRegisterPair(30));
+                    const auto extended = (opcode & 0x0002) != 0;
+
+                    if (extended) {
+                        address |= static_cast<std::uint32_t>(this->readData(this->ioStartAddress + 0x3B) << 16);
+                    }
+
+                    this->registers[rd] = this->flash[address % this->flash.size()];
+
+                    if (opcode & 0x0001) {
+                        address++;
+                        this->writeRegisterPair(30, static_cast<std::uint16_t>(address));
+
+                        if (extended) {
+                            this->writeData(this->ioStartAddress + 0x3B, static_cast<std::uint8_t>(address >> 16));
+                        }
+                    }
+
+                    return nextAddress;
+                }
+                case 0xF: {
+                    // PUSH, POP
+                    if (store) {
+                        this->push(this->registers[rd]);
+
+                    } else {
+                        this->registers[rd] = this->pop();
+                    }
+
+                    return nextAddress;
+                }
+                default: {
+                    break;
+                }
+            }
+        }
+
+        if ((opcode & 0xFE08) == 0x9400 || (opcode & 0xFE0F) == 0x940A) {
+            // Single operand instructions
+            const auto value = this->registers[rd];
+            auto result = value;
+
+            switch (opcode & 0x000F) {
+                case 0x0: {
+                    // COM
+                    result = static_cast<std::uint8_t>(~value);
+                    this->setFlag(StatusRegisterBit::CARRY, true);
+                    this->setFlag(StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW, false);
+                    this->setResultFlags(result);
+                    break;
+                }
+                case 0x1: {
+                    // NEG
+                    result = static_cast<std::uint8_t>(0x00 - value);
+                    this->setFlag(StatusRegisterBit::HALF_CARRY, ((result | value) & 0x08) != 0);
+                    this->setFlag(StatusRegisterBit::CARRY, result != 0x00);
+                    this->setFlag(StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW, result == 0x80);
+                    this->setResultFlags(result);
+                    break;
+                }
+                case 0x2: {
+                    // SWAP
+                    result = static_cast<std::uint8_t>((value << 4) | (value >> 4));
+                    break;
+                }
+                case 0x3: {
+                    // INC
+                    result = static_cast<std::uint8_t>(value + 1);
+                    this->setFlag(StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW, result == 0x80);
+                    this->setResultFlags(result);
+                    break;
+                }
+                case 0x5:
+                case 0x6:
+                case 0x7: {
+                    // ASR, LSR, ROR
+                    const auto shiftIn = (opcode & 0x000F) == 0x5 ? (value & 0x80)
+                        : (opcode & 0x000F) == 0x7 ? (this->getFlag(StatusRegisterBit::CARRY) ? 0x80 : 0x00)
+                        : 0x00;
+
+                    result = static_cast<std::uint8_t>((value >> 1) | shiftIn);
+                    this->setFlag(StatusRegisterBit::CARRY, (value & 0x01) != 0);
+                    this->setFlag(StatusRegisterBit::NEGATIVE, (result & 0x80) != 0);
+                    this->setFlag(
+                        StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW,
+                        this->getFlag(StatusRegisterBit::NEGATIVE) != this->getFlag(StatusRegisterBit::CARRY)
+                    );
+                    this->setResultFlags(result);
+                    break;
+                }
+                case 0xA: {
+                    // DEC
+                    result = static_cast<std::uint8_t>(value - 1);
+                    this->setFlag(StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW, result == 0x7F);
+                    this->setResultFlags(result);
+                    break;
+                }
+                default: {
+                    throw unsupportedInstruction();
+                }
+            }
+
+            this->registers[rd] = result;
+            return nextAddress;
+        }
+
+        if ((opcode & 0xFE0C) == 0x940C) {
+            // JMP, CALL
+            const auto address = static_cast<std::uint32_t>(
+                ((((opcode >> 3) & 0x3E) | (opcode & 0x01)) << 16) | this->fetchWord(nextAddress)
+            );
+
+            if (opcode & 0x0002) {
+                this->pushProgramCounter(nextAddress + 1);
+            }
+
+            return address;
+        }
+
+        if ((opcode & 0xFF0F) == 0x9408) {
+            // BSET, BCLR (SEC, CLI, etc)
+            this->setFlag(static_cast<StatusRegisterBit>((opcode >> 4) & 0x07), (opcode & 0x0080) == 0);
+            return nextAddress;
+        }
+
+        switch (opcode) {
+            case 0x9508:
+            case 0x9518: {
+                // RET, RETI
+                if (opcode == 0x9518) {
+                    this->setFlag(StatusRegisterBit::GLOBAL_INTERRUPT_ENABLE, true);
+                }
+
+                return this->popProgramCounter();
+            }
+            case 0x9409:
+            case 0x9509: {
+                // IJMP, ICALL
+                if (opcode == 0x9509) {
+                    this->pushProgramCounter(nextAddress);
+                }
+
+                return this->readRegisterPair(30);
+            }
+            case 0x9588:
+            case 0x95A8:
+            case 0x95E8: {
+                // SLEEP, WDR, SPM - there's nothing to wake us up, reset us or program the flash.
+                return nextAddress;
+            }
+            case 0x95C8:
+            case 0x95D8: {
+                // LPM, ELPM (implied R0 and Z)
+                auto address = static_cast<std::uint32_t>(this->readRegisterPair(30));
+
+                if (opcode == 0x95D8) {
+                    address |= static_cast<std::uint32_t>(this->readData(this->ioStartAddress + 0x3B) << 16);
+                }
+
+                this->registers[0] = this->flash[address % this->flash.size()];
+                return nextAddress;
+            }
+            default: {
+                break;
+            }
+        }
+
+        if ((opcode & 0xFE00) == 0x9600) {
+            // ADIW, SBIW
+            const auto registerNumber = static_cast<std::uint8_t>(24 + ((opcode >> 3) & 0x06));
+            const auto constant = static_cast<std::uint16_t>((opcode & 0x0F) | ((opcode >> 2) & 0x30));
+            const auto value = this->readRegisterPair(registerNumber);
+            const auto subtraction = (opcode & 0x0100) != 0;
+            const auto result = static_cast<std::uint16_t>(subtraction ? value - constant : value + constant);
+
+            const auto valueMsb = (value & 0x8000) != 0;
+            const auto resultMsb = (result & 0x8000) != 0;
+
+            this->writeRegisterPair(registerNumber, result);
+            this->setFlag(
+                StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW,
+                subtraction ? (valueMsb && !resultMsb) : (!valueMsb && resultMsb)
+            );
+            this->setFlag(StatusRegisterBit::CARRY, subtraction ? (resultMsb && !valueMsb) : (!resultMsb && valueMsb));
+            this->setFlag(StatusRegisterBit::NEGATIVE, resultMsb);
+            this->setFlag(StatusRegisterBit::ZERO, result == 0);
+            this->setFlag(
+                StatusRegisterBit::SIGN,
+                resultMsb != this->getFlag(StatusRegisterBit::TWOS_COMPLEMENT_OVERFLOW)
+            );
+            return nextAddress;
+        }
+
+        if ((opcode & 0xFC00) == 0x9800) {
+            // CBI, SBIC, SBI, SBIS
+            const auto address = this->ioStartAddress + ((opcode >> 3) & 0x1F);
+            const auto value = this->readData(address);
+            const auto bitSet = ((value >> bit) & 0x01) != 0;
+
+            switch (opcode & 0xFF00) {
+                case 0x9800: {
+                    this->writeData(address, static_cast<std::uint8_t>(value & ~(0x01 << bit)));
+                    return nextAddress;
+                }
+                case 0x9A00: {
+                    this->writeData(address, static_cast<std::uint8_t>(value | (0x01 << bit)));
+                    return nextAddress;
+                }
+                case 0x9900: {
+                    return skipNextInstruction(!bitSet);
+                }
+                default: {
+                    return skipNextInstruction(bitSet);
+                }
+            }
+        }
+
+        if ((opcode & 0xF000) == 0xB000) {
+            // IN, OUT
+            const auto address = this->ioStartAddress + ((opcode & 0x0F) | ((opcode >> 5) & 0x30));
+
+            if (opcode & 0x0800) {
+                this->writeData(address, this->registers[rd]);
+
+            } else {
+                this->registers[rd] = this->readData(address);
+            }
+
+            return nextAddress;
+        }
+
+        if ((opcode & 0xF800) == 0xF000) {
+            // BRBS, BRBC (BREQ, BRNE, BRCS, etc)
+            const auto flagSet = this->getFlag(static_cast<StatusRegisterBit>(bit));
+            const auto branchIfSet = (opcode & 0x0400) == 0;
+
+            if (flagSet != branchIfSet) {
+                return nextAddress;
+            }
+
+            auto offset = static_cast<std::int32_t>((opcode >> 3) & 0x7F);
+            if (offset & 0x40) {
+                offset -= 0x80;
+            }
+
+            return static_cast<std::uint32_t>(static_cast<std::int32_t>(nextAddress) + offset);
+        }
+
+        if ((opcode & 0xF808) == 0xF800) {
+            // BLD, BST
+            if (opcode & 0x0200) {
+                this->setFlag(StatusRegisterBit::BIT_COPY_STORAGE, ((this->registers[rd] >> bit) & 0x01) != 0);
+
+            } else {
+                this->registers[rd] = static_cast<std::uint8_t>(
+                    this->getFlag(StatusRegisterBit::BIT_COPY_STORAGE)
+                        ? (this->registers[rd] | (0x01 << bit))
+                        : (this->registers[rd] & ~(0x01 << bit))
+                );
+            }
+
+            return nextAddress;
+        }
+
+        if ((opcode & 0xFC08) == 0xFC00) {
+            // SBRC, SBRS
+            const auto bitSet = ((this->registers[rd] >> bit) & 0x01) != 0;
+            return skipNextInstruction((opcode & 0x0200) ? bitSet : !bitSet);
+        }
+
+        switch (opcode & 0xFF00) {
+            case 0x0100: {
+                // MOVW
+                const auto destination = static_cast<std::uint8_t>(((opcode >> 4) & 0x0F) * 2);
+                const auto source = static_cast<std::uint8_t>((opcode & 0x0F) * 2);
+
+                this->writeRegisterPair(destination, this->readRegisterPair(source));
+                return nextAddress;
+            }
+            case 0x0200: {
+                // MULS
+                this->multiply(
+                    static_cast<std::int8_t>(this->registers[rdUpper]),
+                    static_cast<std::int8_t>(this->registers[16 + (opcode & 0x0F)]),
+                    false
+                );
+                return nextAddress;
+            }
+            case 0x0300: {
+                // MULSU, FMUL, FMULS, FMULSU
+                const auto left = this->registers[16 + ((opcode >> 4) & 0x07)];
+                const auto right = this->registers[16 + (opcode & 0x07)];
+
+                switch (opcode & 0x0088) {
+                    case 0x0000: {
+                        this->multiply(static_cast<std::int8_t>(left), right, false);
+                        break;
+                    }
+                    case 0x0008: {
+                        this->multiply(left, right, true);
+                        break;
+                    }
+                    case 0x0080: {
+                        this->multiply(static_cast<std::int8_t>(left), static_cast<std::int8_t>(right), true);
+                        break;
+                    }
+                    default: {
+                        this->multiply(static_cast<std::int8_t>(left), right, true);
+                        break;
+                    }
+                }
+
+                return nextAddress;
+            }
+            default: {
+                break;
+            }
+        }
+
+        throw unsupportedInstruction();
+    }
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+
+#include "src/Targets/Microchip/AVR/AVR8/TargetParameters.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::DebugToolDrivers::Simulation::Avr
+{
+    /**
+     * An instruction-level model of an AVR8 CPU core, along with the target's program memory, data memory and EEPROM.
+     *
+     * The memory layout is taken from the target parameters, which are extracted from the target's TDF. The core
+     * implements the AVRe+ instruction set, which covers most megaAVR and tinyAVR targets. Execution is not cycle
+     * accurate, and no peripherals are modelled - the I/O registers are just plain data memory. This means interrupts
+     * will never fire, and the SLEEP instruction behaves like a NOP.
+     *
+     * This class is not thread-safe. See SimulatorAvr8Interface for synchronisation.
+     */
+    class Avr8Core
+    {
+    public:
+        enum class StepResult: std::uint8_t
+        {
+            /**
+             * The instruction was executed.
+             */
+            EXECUTED,
+
+            /**
+             * The instruction was a BREAK instruction. The program counter has been advanced past it, so that
+             * execution can be resumed.
+             */
+            BREAK,
+        };
+
+        explicit Avr8Core(const Targets::Microchip::Avr::Avr8Bit::TargetParameters& targetParameters);
+
+        /**
+         * Resets the core. The program counter, status register and general purpose registers are cleared, and the
+         * stack pointer is set to the end of RAM. Memory is left untouched.
+         */
+        void reset();
+
+        /**
+         * Executes the instruction at the program counter.
+         *
+         * This function will throw an exception if the instruction is not supported by the core. In that case, the
+         * state of the core will be left unchanged.
+         *
+         * @return
+         */
+        StepResult step();
+
+        /**
+         * The program counter, in word address form.
+         *
+         * @return
+         */
+        [[nodiscard]] std::uint32_t getProgramCounter() const {
+            return this->programCounter;
+        }
+
+        void setProgramCounter(std::uint32_t programCounter) {
+            this->programCounter = programCounter % this->getFlashWordCount();
+        }
+
+        /**
+         * The number of instructions executed since the core was constructed.
+         *
+         * @return
+         */
+        [[nodiscard]] std::uint64_t getInstructionCount() const {
+            return this->instructionCount;
+        }
+
+        [[nodiscard]] std::uint8_t readRegister(std::uint8_t registerNumber) const {
+            return this->registers.at(registerNumber);
+        }
+
+        void writeRegister(std::uint8_t registerNumber, std::uint8_t value) {
+            this->registers.at(registerNumber) = value;
+        }
+
+        /**
+         * Reads a byte from the data address space. Addresses beyond the end of RAM read as 0x00.
+         *
+         * @param address
+         * @return
+         */
+        [[nodiscard]] std::uint8_t readData(std::uint32_t address) const;
+
+        /**
+         * Writes a byte to the data address space. Writes to addresses beyond the end of RAM are ignored.
+         *
+         * @param address
+         * @param value
+         */
+        void writeData(std::uint32_t address, std::uint8_t value);
+
+        [[nodiscard]] Targets::TargetMemoryBuffer& getFlash() {
+            return this->flash;
+        }
+
+        [[nodiscard]] Targets::TargetMemoryBuffer& getEeprom() {
+            return this->eeprom;
+        }
+
+        [[nodiscard]] std::uint32_t getDataMemorySize() const {
+            return static_cast<std::uint32_t>(this->dataMemory.size());
+        }
+
+    private:
+        enum StatusRegisterBit: std::uint8_t
+        {
+            CARRY = 0,
+            ZERO = 1,
+            NEGATIVE = 2,
+            TWOS_COMPLEMENT_OVERFLOW = 3,
+            SIGN = 4,
+            HALF_CARRY = 5,
+            BIT_COPY_STORAGE = 6,
+            GLOBAL_INTERRUPT_ENABLE = 7,
+        };
+
+        Targets::TargetMemoryBuffer flash;
+        Targets::TargetMemoryBuffer dataMemory;
+        Targets::TargetMemoryBuffer eeprom;
+        std::array<std::uint8_t, 32> registers = {};
+
+        std::uint32_t programCounter = 0;
+        std::uint64_t instructionCount = 0;
+
+        /**
+         * The start address of the I/O registers, in the data address space. The IN/OUT instructions (and similar)
+         * address I/O registers relative to this.
+         */
+        std::uint32_t ioStartAddress = 0x20;
+
+        /**
+         * On most classic AVR8 targets, the general purpose registers are mapped to the start of the data address
+         * space. This isn't the case for XMEGA and UPDI targets.
+         */
+        bool registersMapped = true;
+
+        std::uint32_t ramEndAddress = 0;
+        std::uint32_t statusRegisterAddress = 0x5F;
+        std::uint32_t stackPointerAddress = 0x5D;
+        std::uint32_t stackPointerSize = 2;
+
+        /**
+         * The number of bytes pushed onto the stack by CALL instructions. Targets with more than 128KiB of program
+         * memory have a 22-bit program counter.
+         */
+        std::uint8_t programCounterSize = 2;
+
+        [[nodiscard]] std::uint32_t getFlashWordCount() const {
+            return static_cast<std::uint32_t>(this->flash.size() / 2);
+        }
+
+        [[nodiscard]] std::uint16_t fetchWord(std::uint32_t wordAddress) const;
+
+        /**
+         * Determines whether the instruction at the given word address occupies two words (JMP, CALL, LDS and STS).
+         *
+         * @param wordAddress
+         * @return
+         */
+        [[nodiscard]] bool isTwoWordInstruction(std::uint32_t wordAddress) const;
+
+        [[nodiscard]] bool getFlag(StatusRegisterBit bit) const;
+        void setFlag(StatusRegisterBit bit, bool value);
+
+        /**
+         * Sets the negative, sign and zero flags for the given result, using the current value of the overflow flag.
+         *
+         * @param result
+         */
+        void setResultFlags(std::uint8_t result);
+
+        [[nodiscard]] std::uint16_t readRegisterPair(std::uint8_t lowRegisterNumber) const;
+        void writeRegisterPair(std::uint8_t lowRegisterNumber, std::uint16_t value);
+
+        [[nodiscard]] std::uint32_t getStackPointer() const;
+        void setStackPointer(std::uint32_t stackPointer);
+
+        void push(std::uint8_t value);
+        std::uint8_t pop();
+
+        void pushProgramCounter(std::uint32_t returnAddress);
+        std::uint32_t popProgramCounter();
+
+        std::uint8_t add(std::uint8_t left, std::uint8_t right, bool carry);
+        std::uint8_t subtract(std::uint8_t left, std::uint8_t right, bool carry, bool keepZero);
+        void multiply(std::int32_t left, std::int32_t right, bool fractional);
+
+        /**
+         * Executes the given instruction. Returns the word address of the next instruction.
+         *
+         * @param opcode
+         * @return
+         */
+        std::uint32_t execute(std::uint16_t opcode);
+    };
+}
@@ -0,0 +1,625 @@
+#include "SimulatorAvr8Interface.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QString>
+
+#include "src/Targets/Microchip/AVR/AVR8/TargetDescription/TargetDescriptionFile.hpp"
+
+#include "src/Helpers/Paths.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+#include "src/Exceptions/InvalidConfig.hpp"
+
+namespace Bloom::DebugToolDrivers::Simulation::Avr
+{
+    using namespace Bloom::Exceptions;
+
+    using Targets::Microchip::Avr::Avr8Bit::Avr8TargetConfig;
+    using Targets::Microchip::Avr::Avr8Bit::ProgramMemorySection;
+    using Targets::Microchip::Avr::TargetSignature;
+    using Targets::TargetState;
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetRegister;
+    using Targets::TargetRegisters;
+    using Targets::TargetRegisterDescriptors;
+    using Targets::TargetRegisterType;
+
+    SimulatorAvr8Interface::SimulatorAvr8Interface(std::optional<std::string> firmwareFilePath)
+        : firmwareFilePath(std::move(firmwareFilePath))
+    {}
+
+    SimulatorAvr8Interface::~SimulatorAvr8Interface() {
+        this->stopExecution();
+    }
+
+    void SimulatorAvr8Interface::configure(const Avr8TargetConfig& targetConfig) {
+        using Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionFile;
+
+        const auto targetName = QString::fromStdString(targetConfig.name).toLower();
+        const auto mapping = TargetDescriptionFile::getTargetDescriptionMapping();
+
+        for (auto mappingIt = mapping.begin(); mappingIt != mapping.end(); mappingIt++) {
+            const auto descriptionFiles = mappingIt.value().toArray();
+
+            for (const auto& descriptionFile : descriptionFiles) {
+                if (descriptionFile.toObject().find("targetName")->toString().toLower() == targetName) {
+                    this->targetSignature = TargetSignature(mappingIt.key().toStdString());
+                    return;
+                }
+            }
+        }
+
+        throw InvalidConfig(
+            "The simulator requires the exact name of the target - \"" + targetConfig.name + "\" could not be "
+                "resolved. See " + Paths::homeDomainName() + "/docs/supported-targets"
+        );
+    }
+
+    void SimulatorAvr8Interface::activate() {
+        if (!this->targetParameters.has_value()) {
+            throw Exception("Missing target parameters - cannot simulate target");
+        }
+
+        auto lock = std::unique_lock(this->coreMutex);
+        this->core.emplace(this->targetParameters.value());
+
+        if (this->firmwareFilePath.has_value()) {
+            this->loadFirmware();
+        }
+
+        this->targetState = TargetState::STOPPED;
+    }
+
+    void SimulatorAvr8Interface::deactivate() {
+        this->stopExecution();
+        this->programmingModeEnabled = false;
+    }
+
+    void SimulatorAvr8Interface::stop() {
+        this->stopExecution();
+    }
+
+    void SimulatorAvr8Interface::run() {
+        this->startExecution(std::nullopt);
+    }
+
+    void SimulatorAvr8Interface::runTo(std::uint32_t address) {
+        this->startExecution(address);
+    }
+
+    void SimulatorAvr8Interface::step() {
+        if (this->targetState == TargetState::RUNNING) {
+            throw Exception("Cannot step the simulated target while it is running");
+        }
+
+        {
+            auto lock = std::unique_lock(this->coreMutex);
+            this->getCore().step();
+        }
+
+        if (auto* notifier = this->targetStateChangeNotifier.load()) {
+            notifier->notify();
+        }
+    }
+
+    void SimulatorAvr8Interface::reset() {
+        this->stopExecution();
+
+        auto lock = std::unique_lock(this->coreMutex);
+        this->getCore().reset();
+    }
+
+    TargetSignature SimulatorAvr8Interface::getDeviceId() {
+        if (!this->targetSignature.has_value()) {
+            throw Exception("Target signature unknown - the simulator has not been configured");
+        }
+
+        return this->targetSignature.value();
+    }
+
+    void SimulatorAvr8Interface::setBreakpoint(std::uint32_t address) {
+        auto lock = std::unique_lock(this->coreMutex);
+        this->breakpointAddresses.insert(address);
+    }
+
+    void SimulatorAvr8Interface::clearBreakpoint(std::uint32_t address) {
+        auto lock = std::unique_lock(this->coreMutex);
+        this->breakpointAddresses.erase(address);
+    }
+
+    void SimulatorAvr8Interface::clearAllBreakpoints() {
+        auto lock = std::unique_lock(this->coreMutex);
+        this->breakpointAddresses.clear();
+    }
+
+    std::uint32_t SimulatorAvr8Interface::getProgramCounter() {
+        if (this->targetState == TargetState::RUNNING) {
+            throw Exception("Cannot read the program counter while the simulated target is running");
+        }
+
+        auto lock = std::unique_lock(this->coreMutex);
+        return this->getCore().getProgramCounter() * 2;
+    }
+
+    void SimulatorAvr8Interface::setProgramCounter(std::uint32_t programCounter) {
+        if (this->targetState == TargetState::RUNNING) {
+            throw Exception("Cannot set the program counter while the simulated target is running");
+        }
+
+        auto lock = std::unique_lock(this->coreMutex);
+
+        // The program counter will be given in byte address form, but the core works with word addresses.
+        this->getCore().setProgramCounter(programCounter / 2);
+    }
+
+    TargetRegisters SimulatorAvr8Interface::readRegisters(const TargetRegisterDescriptors& descriptors) {
+        auto output = TargetRegisters();
+        const auto gpRegisterStartAddress = this->targetParameters->gpRegisterStartAddress.value_or(0);
+
+        auto lock = std::unique_lock(this->coreMutex);
+        auto& core = this->getCore();
+
+        for (const auto& descriptor : descriptors) {
+            if (!descriptor.startAddress.has_value()) {
+                Logger::debug(
+                    "Attempted to read register in the absence of a start address - register name: "
+                        + descriptor.name.value_or("unknown")
+                );
+                continue;
+            }
+
+            const auto startAddress = descriptor.startAddress.value();
+            auto value = TargetMemoryBuffer();
+
+            // Multibyte AVR8 registers are stored in LSB form - we read them in reverse, to obtain the MSB form.
+            for (auto i = descriptor.size; i > 0; i--) {
+                const auto address = startAddress + i - 1;
+
+                value.push_back(
+                    descriptor.type == TargetRegisterType::GENERAL_PURPOSE_REGISTER
+                        ? core.readRegister(static_cast<std::uint8_t>(address - gpRegisterStartAddress))
+                        : core.readData(address)
+                );
+            }
+
+            output.emplace_back(descriptor, std::move(value));
+        }
+
+        return output;
+    }
+
+    void SimulatorAvr8Interface::writeRegisters(const TargetRegisters& registers) {
+        const auto gpRegisterStartAddress = this->targetParameters->gpRegisterStartAddress.value_or(0);
+
+        auto lock = std::unique_lock(this->coreMutex);
+        auto& core = this->getCore();
+
+        for (const auto& reg : registers) {
+            const auto& descriptor = reg.descriptor;
+
+            if (reg.value.empty()) {
+                throw Exception("Cannot write empty register value");
+            }
+
+            if (reg.value.size() > descriptor.size) {
+                throw Exception("Register value exceeds size specified by register descriptor.");
+            }
+
+            const auto startAddress = descriptor.startAddress.value();
+
+            // The value is in MSB form - the least significant byte lives at the register's start address.
+            for (auto i = std::uint32_t(0); i < descriptor.size; i++) {
+                const auto address = startAddress + i;
+                const auto byte = i < reg.value.size() ? reg.value[reg.value.size() - 1 - i] : std::uint8_t(0x00);
+
+                if (descriptor.type == TargetRegisterType::GENERAL_PURPOSE_REGISTER) {
+                    core.writeRegister(static_cast<std::uint8_t>(address - gpRegisterStartAddress), byte);
+                    continue;
+                }
+
+                core.writeData(address, byte);
+            }
+        }
+    }
+
+    TargetMemoryBuffer SimulatorAvr8Interface::readMemory(
+        TargetMemoryType memoryType,
+        std::uint32_t startAddress,
+        std::uint32_t bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        if (
+            this->programmingModeEnabled
+            && (memoryType == TargetMemoryType::RAM || memoryType == TargetMemoryType::EEPROM)
+        ) {
+            throw Exception("Cannot access RAM or EEPROM when programming mode is enabled");
+        }
+
+        auto lock = std::unique_lock(this->coreMutex);
+        auto& core = this->getCore();
+
+        auto output = TargetMemoryBuffer();
+        output.reserve(bytes);
+
+        switch (memoryType) {
+            case TargetMemoryType::FLASH:
+            case TargetMemoryType::EEPROM: {
+                const auto& memory = memoryType == TargetMemoryType::FLASH ? core.getFlash() : core.getEeprom();
+                const auto offset = startAddress - (
+                    memoryType == TargetMemoryType::FLASH
+                        ? this->getFlashStartAddress()
+                        : this->getEepromStartAddress()
+                );
+
+                if (offset > memory.size() || bytes > (memory.size() - offset)) {
+                    throw Exception("Memory read exceeds the bounds of the simulated memory");
+                }
+
+                output.insert(output.end(), memory.begin() + offset, memory.begin() + offset + bytes);
+                break;
+            }
+            case TargetMemoryType::RAM: {
+                if (startAddress > core.getDataMemorySize() || bytes > (core.getDataMemorySize() - startAddress)) {
+                    throw Exception("Memory read exceeds the bounds of the simulated data memory");
+                }
+
+                for (auto address = startAddress; address < startAddress + bytes; address++) {
+                    output.push_back(core.readData(address));
+                }
+                break;
+            }
+            default: {
+                throw Exception("Unsupported memory type");
+            }
+        }
+
+        // Bytes at excluded addresses are returned as 0x00, as they would be from a physical debug tool
+        for (const auto& excludedRange : excludedAddressRanges) {
+            for (
+                auto address = std::max(excludedRange.startAddress, startAddress);
+                address <= excludedRange.endAddress && address < startAddress + bytes;
+                address++
+            ) {
+                output[address - startAddress] = 0x00;
+            }
+        }
+
+        return output;
+    }
+
+    void SimulatorAvr8Interface::writeMemory(
+        TargetMemoryType memoryType,
+        std::uint32_t startAddress,
+        const TargetMemoryBuffer& buffer
+    ) {
+        if (
+            this->programmingModeEnabled
+            && (memoryType == TargetMemoryType::RAM || memoryType == TargetMemoryType::EEPROM)
+        ) {
+            throw Exception("Cannot access RAM or EEPROM when programming mode is enabled");
+        }
+
+        auto lock = std::unique_lock(this->coreMutex);
+        auto& core = this->getCore();
+
+        switch (memoryType) {
+            case TargetMemoryType::FLASH:
+            case TargetMemoryType::EEPROM: {
+                auto& memory = memoryType == TargetMemoryType::FLASH ? core.getFlash() : core.getEeprom();
+                const auto offset = startAddress - (
+                    memoryType == TargetMemoryType::FLASH
+                        ? this->getFlashStartAddress()
+                        : this->getEepromStartAddress()
+                );
+
+                if (offset > memory.size() || buffer.size() > (memory.size() - offset)) {
+                    throw Exception("Memory write exceeds the bounds of the simulated memory");
+                }
+
+                std::copy(buffer.begin(), buffer.end(), memory.begin() + offset);
+                break;
+            }
+            case TargetMemoryType::RAM: {
+                if (
+                    startAddress > core.getDataMemorySize()
+                    || buffer.size() > (core.getDataMemorySize() - startAddress)
+                ) {
+                    throw Exception("Memory write exceeds the bounds of the simulated data memory");
+                }
+
+                auto address = startAddress;
+                for (const auto byte : buffer) {
+                    core.writeData(address++, byte);
+                }
+                break;
+            }
+            default: {
+                throw Exception("Unsupported memory type");
+            }
+        }
+    }
+
+    void SimulatorAvr8Interface::eraseProgramMemory(std::optional<ProgramMemorySection> section) {
+        auto lock = std::unique_lock(this->coreMutex);
+        auto& flash = this->getCore().getFlash();
+
+        auto eraseBegin = flash.begin();
+        auto eraseEnd = flash.end();
+
+        if (section.has_value() && this->targetParameters->bootSectionStartAddress.has_value()) {
+            const auto bootSectionOffset = std::min(
+                static_cast<std::size_t>(
+                    this->targetParameters->bootSectionStartAddress.value() - this->getFlashStartAddress()
+                ),
+                flash.size()
+            );
+
+            if (section == ProgramMemorySection::BOOT) {
+                eraseBegin = flash.begin() + static_cast<std::ptrdiff_t>(bootSectionOffset);
+
+            } else {
+                eraseEnd = flash.begin() + static_cast<std::ptrdiff_t>(bootSectionOffset);
+            }
+        }
+
+        std::fill(eraseBegin, eraseEnd, 0xFF);
+    }
+
+    void SimulatorAvr8Interface::eraseProgramMemoryPage(std::uint32_t pageStartAddress) {
+        auto lock = std::unique_lock(this->coreMutex);
+        auto& flash = this->getCore().getFlash();
+
+        const auto pageSize = static_cast<std::size_t>(this->targetParameters->flashPageSize.value_or(2));
+        const auto offset = static_cast<std::size_t>(pageStartAddress - this->getFlashStartAddress());
+
+        if (offset >= flash.size()) {
+            throw Exception("Program memory page address exceeds the bounds of the simulated memory");
+        }
+
+        std::fill(
+            flash.begin() + static_cast<std::ptrdiff_t>(offset),
+            flash.begin() + static_cast<std::ptrdiff_t>(std::min(offset + pageSize, flash.size())),
+            0xFF
+        );
+    }
+
+    void SimulatorAvr8Interface::enableProgrammingMode() {
+        this->stopExecution();
+        this->programmingModeEnabled = true;
+    }
+
+    void SimulatorAvr8Interface::disableProgrammingMode() {
+        this->programmingModeEnabled = false;
+        this->reset();
+    }
+
+    Avr8Core& SimulatorAvr8Interface::getCore() {
+        if (!this->core.has_value()) {
+            throw Exception("The simulated target has not been activated");
+        }
+
+        return this->core.value();
+    }
+
+    void SimulatorAvr8Interface::startExecution(std::optional<std::uint32_t> runToAddress) {
+        this->stopExecution();
+
+        {
+            auto lock = std::unique_lock(this->coreMutex);
+            this->getCore();
+        }
+
+        this->targetState = TargetState::RUNNING;
+        this->executionThread = std::thread(&SimulatorAvr8Interface::execute, this, runToAddress);
+    }
+
+    void SimulatorAvr8Interface::execute(std::optional<std::uint32_t> runToAddress) {
+        /*
+         * When resuming execution from a breakpoint, we must execute the instruction at the breakpoint address before
+         * we can start checking for breakpoints. Otherwise, we'd never get past it.
+         */
+        auto firstInstruction = true;
+        auto halted = false;
+
+        try {
+            while (!halted && !this->stopRequested) {
+                auto lock = std::unique_lock(this->coreMutex);
+                auto& core = this->getCore();
+
+                for (auto i = std::uint32_t(0); i < SimulatorAvr8Interface::INSTRUCTION_BATCH_SIZE; i++) {
+                    const auto programCounter = core.getProgramCounter() * 2;
+
+                    if (
+                        !firstInstruction
+                        && (this->breakpointAddresses.contains(programCounter) || programCounter == runToAddress)
+                    ) {
+                        halted = true;
+                        break;
+                    }
+
+                    firstInstruction = false;
+
+                    if (core.step() == Avr8Core::StepResult::BREAK) {
+                        halted = true;
+                        break;
+                    }
+                }
+            }
+
+        } catch (const Exception& exception) {
+            Logger::error("Simulated target halted - " + exception.getMessage());
+        }
+
+        this->targetState = TargetState::STOPPED;
+
+        if (auto* notifier = this->targetStateChangeNotifier.load()) {
+            notifier->notify();
+        }
+    }
+
+    void SimulatorAvr8Interface::stopExecution() {
+        if (!this->executionThread.joinable()) {
+            return;
+        }
+
+        this->stopRequested = true;
+        this->executionThread.join();
+        this->stopRequested = false;
+    }
+
+    void SimulatorAvr8Interface::loadFirmware() {
+        auto filePath = std::filesystem::path(this->firmwareFilePath.value());
+
+        if (filePath.is_relative()) {
+            filePath = std::filesystem::path(Paths::projectDirPath()) / filePath;
+        }
+
+        if (!std::filesystem::exists(filePath)) {
+            throw InvalidConfig("Firmware file (\"" + filePath.string() + "\") not found");
+        }
+
+        auto extension = filePath.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+        if (extension == ".hex") {
+            this->loadIntelHexFile(filePath.string());
+
+        } else {
+            this->loadBinaryFile(filePath.string());
+        }
+
+        Logger::info("Loaded firmware image into simulated program memory - " + filePath.string());
+    }
+
+    void SimulatorAvr8Interface::loadIntelHexFile(const std::string& filePath) {
+        auto file = std::ifstream(filePath);
+        auto& flash = this->getCore().getFlash();
+
+        auto baseAddress = std::uint32_t(0);
+        auto line = std::string();
+        auto lineNumber = std::size_t(0);
+
+        while (std::getline(file, line)) {
+            lineNumber++;
+
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+
+            if (line.empty()) {
+                continue;
+            }
+
+            const auto invalidRecord = [&filePath, lineNumber] {
+                return Exception(
+                    "Invalid Intel HEX record in " + filePath + " (line " + std::to_string(lineNumber) + ")"
+                );
+            };
+
+            if (line.front() != ':' || line.size() < 11 || (line.size() - 1) % 2 != 0) {
+                throw invalidRecord();
+            }
+
+            auto record = std::vector<std::uint8_t>();
+            for (auto i = std::size_t(1); i < line.size(); i += 2) {
+                auto conversionOk = false;
+                record.push_back(static_cast<std::uint8_t>(
+                    QString::fromStdString(line.substr(i, 2)).toUInt(&conversionOk, 16)
+                ));
+
+                if (!conversionOk) {
+                    throw invalidRecord();
+                }
+            }
+
+            const auto dataSize = record[0];
+            if (record.size() != static_cast<std::size_t>(dataSize) + 5) {
+                throw invalidRecord();
+            }
+
+            auto checksum = std::uint8_t(0);
+            for (const auto byte : record) {
+                checksum = static_cast<std::uint8_t>(checksum + byte);
+            }
+
+            if (checksum != 0) {
+                throw invalidRecord();
+            }
+
+            const auto address = static_cast<std::uint32_t>((record[1] << 8) | record[2]);
+            const auto recordType = record[3];
+            const auto data = std::vector<std::uint8_t>(record.begin() + 4, record.begin() + 4 + dataSize);
+
+            switch (recordType) {
+                case 0x00: {
+                    // Data record
+                    const auto offset = baseAddress + address;
+
+                    if (offset > flash.size() || data.size() > flash.size() - offset) {
+                        throw Exception("Firmware image exceeds the size of the target's program memory");
+                    }
+
+                    std::copy(data.begin(), data.end(), flash.begin() + offset);
+                    break;
+                }
+                case 0x01: {
+                    // End of file record
+                    return;
+                }
+                case 0x02: {
+                    // Extended segment address record
+                    if (data.size() != 2) {
+                        throw invalidRecord();
+                    }
+
+                    baseAddress = static_cast<std::uint32_t>(((data[0] << 8) | data[1]) << 4);
+                    break;
+                }
+                case 0x04: {
+                    // Extended linear address record
+                    if (data.size() != 2) {
+                        throw invalidRecord();
+                    }
+
+                    baseAddress = static_cast<std::uint32_t>(((data[0] << 8) | data[1]) << 16);
+                    break;
+                }
+                default: {
+                    // Start address records are of no use to us - execution always begins at the reset vector
+                    break;
+                }
+            }
+        }
+    }
+
+    void SimulatorAvr8Interface::loadBinaryFile(const std::string& filePath) {
+        auto file = std::ifstream(filePath, std::ios::binary);
+        auto& flash = this->getCore().getFlash();
+
+        const auto data = std::vector<unsigned char>(
+            (std::istreambuf_iterator<char>(file)),
+            std::istreambuf_iterator<char>()
+        );
+
+        if (data.size() > flash.size()) {
+            throw Exception("Firmware image exceeds the size of the target's program memory");
+        }
+
+        std::copy(data.begin(), data.end(), flash.begin());
+    }
+
+    std::uint32_t SimulatorAvr8Interface::getFlashStartAddress() const {
+        return this->targetParameters.has_value() ? this->targetParameters->flashStartAddress.value_or(0) : 0;
+    }
+
+    std::uint32_t SimulatorAvr8Interface::getEepromStartAddress() const {
+        return this->targetParameters.has_value() ? this->targetParameters->eepromStartAddress.value_or(0) : 0;
+    }
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+#include "src/DebugToolDrivers/TargetInterfaces/Microchip/AVR/AVR8/Avr8DebugInterface.hpp"
+#include "Avr8Core.hpp"
+
+#include "src/Targets/Microchip/AVR/AVR8/Avr8TargetConfig.hpp"
+#include "src/Targets/Microchip/AVR/AVR8/TargetParameters.hpp"
+#include "src/Targets/Microchip/AVR/TargetSignature.hpp"
+
+namespace Bloom::DebugToolDrivers::Simulation::Avr
+{
+    /**
+     * An Avr8DebugInterface implementation that drives a simulated AVR8 target, as opposed to a physical one.
+     *
+     * The simulated target is built from the target parameters (which are extracted from the target's TDF), and
+     * executes code via the Avr8Core class. When the target is running, code is executed on a dedicated thread. All
+     * access to the core is serialised via this->coreMutex.
+     *
+     * Because there is no physical target to query, the target signature is resolved from the target name in the
+     * user's configuration. An exact target name is therefore required - the generic "avr8" target name cannot be
+     * used with the simulator.
+     */
+    class SimulatorAvr8Interface: public TargetInterfaces::Microchip::Avr::Avr8::Avr8DebugInterface
+    {
+    public:
+        /**
+         * The number of instructions executed by the execution thread, between acquisitions of this->coreMutex.
+         */
+        static constexpr std::uint32_t INSTRUCTION_BATCH_SIZE = 4096;
+
+        /**
+         * @param firmwareFilePath
+         *  An optional path to a firmware image, to be loaded into the simulated target's program memory upon
+         *  activation. Files with a ".hex" extension are parsed as Intel HEX. All others are loaded as raw binary.
+         */
+        explicit SimulatorAvr8Interface(std::optional<std::string> firmwareFilePath);
+
+        ~SimulatorAvr8Interface() override;
+
+        SimulatorAvr8Interface(const SimulatorAvr8Interface& other) = delete;
+        SimulatorAvr8Interface(SimulatorAvr8Interface&& other) = delete;
+
+        SimulatorAvr8Interface& operator = (const SimulatorAvr8Interface& other) = delete;
+        SimulatorAvr8Interface& operator = (SimulatorAvr8Interface&& other) = delete;
+
+        /**
+         * Resolves the target signature from the configured target name.
+         *
+         * @param targetConfig
+         */
+        void configure(const Targets::Microchip::Avr::Avr8Bit::Avr8TargetConfig& targetConfig) override;
+
+        void setFamily(Targets::Microchip::Avr::Avr8Bit::Family family) override {
+            this->family = family;
+        }
+
+        void setTargetParameters(const Targets::Microchip::Avr::Avr8Bit::TargetParameters& config) override {
+            this->targetParameters = config;
+        }
+
+        void init() override {}
+
+        /**
+         * Constructs the simulated target from the target parameters, and loads the firmware image (if one was
+         * provided).
+         */
+        void activate() override;
+
+        void deactivate() override;
+
+        void stop() override;
+
+        void run() override;
+
+        void runTo(std::uint32_t address) override;
+
+        void step() override;
+
+        void reset() override;
+
+        Targets::Microchip::Avr::TargetSignature getDeviceId() override;
+
+        void setBreakpoint(std::uint32_t address) override;
+
+        void clearBreakpoint(std::uint32_t address) override;
+
+        void clearAllBreakpoints() override;
+
+        /**
+         * The program counter can only be accessed when the simulated target is stopped. This function (along with
+         * setProgramCounter() and step()) will throw an exception if the target is running - it will not halt the
+         * target.
+         *
+         * @return
+         */
+        std::uint32_t getProgramCounter() override;
+
+        void setProgramCounter(std::uint32_t programCounter) override;
+
+        Targets::TargetRegisters readRegisters(const Targets::TargetRegisterDescriptors& descriptors) override;
+
+        void writeRegisters(const Targets::TargetRegisters& registers) override;
+
+        Targets::TargetMemoryBuffer readMemory(
+            Targets::TargetMemoryType memoryType,
+            std::uint32_t startAddress,
+            std::uint32_t bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
+        ) override;
+
+        void writeMemory(
+            Targets::TargetMemoryType memoryType,
+            std::uint32_t startAddress,
+            const Targets::TargetMemoryBuffer& buffer
+        ) override;
+
+        void eraseProgramMemory(
+            std::optional<Targets::Microchip::Avr::Avr8Bit::ProgramMemorySection> section = std::nullopt
+        ) override;
+
+        /**
+         * The simulated program memory can be erased one page at a time.
+         *
+         * @return
+         */
+        bool pageGranularProgrammingSupported() override {
+            return true;
+        }
+
+        void eraseProgramMemoryPage(std::uint32_t pageStartAddress) override;
+
+        Targets::TargetState getTargetState() override {
+            return this->targetState;
+        }
+
+        /**
+         * The execution thread will record a notification on the given notifier, whenever the target stops of its own
+         * accord (upon hitting a breakpoint or BREAK instruction, or encountering an unsupported instruction).
+         *
+         * @param notifier
+         * @return
+         */
+        bool setTargetStateChangeNotifier(NotifierInterface* notifier) override {
+            this->targetStateChangeNotifier = notifier;
+            return true;
+        }
+
+        void enableProgrammingMode() override;
+
+        void disableProgrammingMode() override;
+
+    private:
+        std::optional<std::string> firmwareFilePath;
+
+        std::optional<Targets::Microchip::Avr::Avr8Bit::Family> family;
+        std::optional<Targets::Microchip::Avr::Avr8Bit::TargetParameters> targetParameters;
+        std::optional<Targets::Microchip::Avr::TargetSignature> targetSignature;
+
+        std::optional<Avr8Core> core;
+        std::mutex coreMutex;
+
+        /**
+         * Software breakpoints, in byte address form. Guarded by this->coreMutex.
+         */
+        std::set<std::uint32_t> breakpointAddresses;
+
+        std::thread executionThread;
+        std::atomic<bool> stopRequested = false;
+        std::atomic<Targets::TargetState> targetState = Targets::TargetState::STOPPED;
+        std::atomic<NotifierInterface*> targetStateChangeNotifier = nullptr;
+
+        bool programmingModeEnabled = false;
+
+        /**
+         * Returns the simulated core. Callers must hold this->coreMutex.
+         *
+         * @return
+         */
+        Avr8Core& getCore();
+
+        /**
+         * Starts executing code on the execution thread.
+         *
+         * @param runToAddress
+         *  An optional byte address at which to stop execution, in addition to any breakpoints.
+         */
+        void startExecution(std::optional<std::uint32_t> runToAddress);
+
+        /**
+         * Entry point for the execution thread.
+         *
+         * @param runToAddress
+         */
+        void execute(std::optional<std::uint32_t> runToAddress);
+
+        /**
+         * Stops the execution thread (if it's running) and waits for it to exit.
+         */
+        void stopExecution();
+
+        /**
+         * Loads the firmware image at this->firmwareFilePath into program memory.
+         */
+        void loadFirmware();
+
+        /**
+         * Parses an Intel HEX file and writes the data records to program memory.
+         *
+         * @param filePath
+         */
+        void loadIntelHexFile(const std::string& filePath);
+
+        /**
+         * Writes a raw binary file to the start of program memory.
+         *
+         * @param filePath
+         */
+        void loadBinaryFile(const std::string& filePath);
+
+        [[nodiscard]] std::uint32_t getFlashStartAddress() const;
+        [[nodiscard]] std::uint32_t getEepromStartAddress() const;
+    };
+}
@@ -0,0 +1,22 @@
+#include "Simulator.hpp"
+
+namespace Bloom::DebugToolDrivers
+{
+    using Simulation::Avr::SimulatorAvr8Interface;
+
+    Simulator::Simulator(const DebugToolConfig& debugToolConfig) {
+        if (debugToolConfig.jsonObject.contains("firmwarePath")) {
+            this->firmwareFilePath = debugToolConfig.jsonObject.find("firmwarePath")->toString().toStdString();
+        }
+    }
+
+    void Simulator::init() {
+        this->avr8Interface = std::make_unique<SimulatorAvr8Interface>(this->firmwareFilePath);
+        this->setInitialised(true);
+    }
+
+    void Simulator::close() {
+        this->avr8Interface.reset();
+        this->setInitialised(false);
+    }
+}
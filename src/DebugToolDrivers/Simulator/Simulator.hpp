@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "src/DebugToolDrivers/DebugTool.hpp"
+#include "src/DebugToolDrivers/Simulator/AVR/SimulatorAvr8Interface.hpp"
+
+#include "src/ProjectConfig.hpp"
+
+namespace Bloom::DebugToolDrivers
+{
+    /**
+     * The simulator is a virtual debug tool, providing access to a simulated target, as opposed to a physical one.
+     * No hardware is required.
+     *
+     * The simulated target is modelled from the target's TDF. Firmware can be loaded via GDB, or from a file
+     * specified in the debug tool configuration:
+     *
+     *  "tool": {
+     *      "name": "simulator",
+     *      "firmwarePath": "build/firmware.hex"
+     *  }
+     *
+     * Relative firmware paths are resolved from the project directory.
+     *
+     * Currently, only AVR8 targets can be simulated. See the SimulatorAvr8Interface class for more.
+     */
+    class Simulator: public DebugTool
+    {
+    public:
+        explicit Simulator(const DebugToolConfig& debugToolConfig);
+
+        void init() override;
+
+        void close() override;
+
+        std::string getName() override {
+            return "Simulator";
+        }
+
+        std::string getSerialNumber() override {
+            return "SIMULATOR";
+        }
+
+        TargetInterfaces::Microchip::Avr::Avr8::Avr8DebugInterface* getAvr8DebugInterface() override {
+            return this->avr8Interface.get();
+        }
+
+    private:
+        std::optional<std::string> firmwareFilePath;
+        std::unique_ptr<Simulation::Avr::SimulatorAvr8Interface> avr8Interface = nullptr;
+    };
+}
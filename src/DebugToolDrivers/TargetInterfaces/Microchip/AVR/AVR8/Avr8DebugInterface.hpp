@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <set>
+#include <vector>
 #include <optional>
 
 #include "src/Targets/Microchip/AVR/AVR8/Avr8TargetConfig.hpp"
@@ -12,6 +13,8 @@
 #include "src/Targets/Microchip/AVR/AVR8/ProgramMemorySection.hpp"
 #include "src/Targets/Microchip/AVR/AVR8/TargetParameters.hpp"
 
+#include "src/Helpers/NotifierInterface.hpp"
+
 #include "src/Targets/TargetState.hpp"
 #include "src/Targets/TargetRegister.hpp"
 #include "src/Targets/TargetMemory.hpp"
@@ -131,6 +134,32 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
          */
         virtual void clearBreakpoint(std::uint32_t address) = 0;
 
+        /**
+         * Should set software breakpoints at the given addresses.
+         *
+         * The default implementation sets each breakpoint individually.
+         *
+         * @param addresses
+         */
+        virtual void setBreakpoints(const std::vector<std::uint32_t>& addresses) {
+            for (const auto address : addresses) {
+                this->setBreakpoint(address);
+            }
+        }
+
+        /**
+         * Should remove the software breakpoints at the given addresses.
+         *
+         * The default implementation removes each breakpoint individually.
+         *
+         * @param addresses
+         */
+        virtual void clearBreakpoints(const std::vector<std::uint32_t>& addresses) {
+            for (const auto address : addresses) {
+                this->clearBreakpoint(address);
+            }
+        }
+
         /**
          * Should remove all software and hardware breakpoints on the target.
          */
@@ -206,6 +235,25 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
             std::optional<Targets::Microchip::Avr::Avr8Bit::ProgramMemorySection> section = std::nullopt
         ) = 0;
 
+        /**
+         * Should report whether program memory writes can be performed one page at a time, without erasing the
+         * entire program memory (or an entire section of it) beforehand.
+         *
+         * This is the case when the interface can erase individual pages (see eraseProgramMemoryPage()), or when the
+         * debug tool erases each page implicitly, upon writing to it.
+         *
+         * @return
+         */
+        virtual bool pageGranularProgrammingSupported() = 0;
+
+        /**
+         * Should erase a single page of program memory, if the interface requires pages to be erased before they're
+         * written to. Interfaces that erase pages implicitly, upon writing, should do nothing here.
+         *
+         * @param pageStartAddress
+         */
+        virtual void eraseProgramMemoryPage(std::uint32_t pageStartAddress) = 0;
+
         /**
          * Should obtain the current target state.
          *
@@ -213,6 +261,21 @@ namespace Bloom::DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
          */
         virtual Targets::TargetState getTargetState() = 0;
 
+        /**
+         * Debug interfaces that are able to detect target state changes (such as break events) without being polled,
+         * should record a notification on the given notifier whenever such a change occurs.
+         *
+         * The default implementation does nothing - the caller will have to poll getTargetState() for changes.
+         *
+         * @param notifier
+         *
+         * @return
+         *  True if the interface will issue notifications on the given notifier, false otherwise.
+         */
+        virtual bool setTargetStateChangeNotifier(NotifierInterface* notifier) {
+            return false;
+        }
+
         /**
          * Should prepare the debug interface for programming the target.
          */
@@ -0,0 +1,166 @@
+#include "BulkInterface.hpp"
+
+#include <string>
+#include <algorithm>
+
+#include "src/Logger/Logger.hpp"
+
+#include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+
+namespace Bloom::Usb
+{
+    using namespace Bloom::Exceptions;
+
+    void BulkInterface::init() {
+        if (this->libUsbDevice == nullptr || this->libUsbDeviceHandle == nullptr) {
+            throw DeviceInitializationFailure(
+                "Cannot initialise bulk interface without libusb device pointer and device handle."
+            );
+        }
+
+        const auto [inEndpoint, outEndpoint] = this->resolveEndpoints(LIBUSB_TRANSFER_TYPE_BULK);
+
+        if (inEndpoint.wMaxPacketSize < 1 || outEndpoint.wMaxPacketSize < 1) {
+            throw DeviceInitializationFailure(
+                "Invalid bulk endpoint packet size for USB interface " + std::to_string(this->getNumber())
+            );
+        }
+
+        this->inEndpointAddress = inEndpoint.bEndpointAddress;
+        this->outEndpointAddress = outEndpoint.bEndpointAddress;
+        this->inputPacketSize = static_cast<std::size_t>(inEndpoint.wMaxPacketSize);
+        this->outputPacketSize = static_cast<std::size_t>(outEndpoint.wMaxPacketSize);
+        this->maximumTransferSize = std::min(this->inputPacketSize, this->outputPacketSize);
+
+        this->claim();
+        this->initialised = true;
+    }
+
+    std::vector<unsigned char> BulkInterface::read(unsigned int timeout) {
+        auto output = std::vector<unsigned char>(this->maximumTransferSize);
+        int transferred = 0;
+
+        const auto libUsbStatusCode = libusb_bulk_transfer(
+            this->libUsbDeviceHandle,
+            this->inEndpointAddress,
+            output.data(),
+            static_cast<int>(output.size()),
+            &transferred,
+            timeout
+        );
+
+        if (libUsbStatusCode == LIBUSB_ERROR_TIMEOUT) {
+            return {};
+        }
+
+        if (libUsbStatusCode != 0) {
+            throw DeviceCommunicationFailure(
+                "Failed to read from USB bulk endpoint. Error code returned: " + std::to_string(libUsbStatusCode)
+            );
+        }
+
+        output.resize(static_cast<std::size_t>(transferred));
+        return output;
+    }
+
+    void BulkInterface::write(const std::vector<unsigned char>& buffer) {
+        this->write(buffer.data(), buffer.size());
+    }
+
+    void BulkInterface::write(const unsigned char* data, std::size_t length) {
+        if (length > this->maximumTransferSize) {
+            throw DeviceCommunicationFailure(
+                "Cannot send data via USB bulk endpoint - data exceeds maximum transfer size."
+            );
+        }
+
+        int transferred = 0;
+        const auto libUsbStatusCode = libusb_bulk_transfer(
+            this->libUsbDeviceHandle,
+            this->outEndpointAddress,
+            const_cast<unsigned char*>(data),
+            static_cast<int>(length),
+            &transferred,
+            5000
+        );
+
+        if (libUsbStatusCode != 0 || static_cast<std::size_t>(transferred) != length) {
+            Logger::debug("Attempted to write " + std::to_string(length)
+                + " bytes to USB bulk endpoint. Bytes written: " + std::to_string(transferred));
+            throw DeviceCommunicationFailure("Failed to write data to USB bulk endpoint.");
+        }
+    }
+
+    std::optional<std::uint8_t> BulkInterface::findCmsisDapInterfaceNumber(
+        libusb_device* libUsbDevice,
+        libusb_device_handle* libUsbDeviceHandle
+    ) {
+        libusb_config_descriptor* configDescriptor = nullptr;
+        if (libusb_get_active_config_descriptor(libUsbDevice, &configDescriptor) < 0) {
+            return std::nullopt;
+        }
+
+        auto output = std::optional<std::uint8_t>();
+
+        for (auto interfaceIndex = 0; interfaceIndex < configDescriptor->bNumInterfaces; ++interfaceIndex) {
+            const auto& usbInterface = configDescriptor->interface[interfaceIndex];
+            if (usbInterface.num_altsetting < 1) {
+                continue;
+            }
+
+            const auto& interfaceDescriptor = usbInterface.altsetting[0];
+            if (
+                interfaceDescriptor.bInterfaceClass != LIBUSB_CLASS_VENDOR_SPEC
+                || interfaceDescriptor.iInterface == 0
+            ) {
+                continue;
+            }
+
+            auto bulkInEndpointFound = false;
+            auto bulkOutEndpointFound = false;
+
+            for (auto endpointIndex = 0; endpointIndex < interfaceDescriptor.bNumEndpoints; ++endpointIndex) {
+                const auto& endpoint = interfaceDescriptor.endpoint[endpointIndex];
+
+                if ((endpoint.bmAttributes & LIBUSB_TRANSFER_TYPE_MASK) != LIBUSB_TRANSFER_TYPE_BULK) {
+                    continue;
+                }
+
+                if ((endpoint.bEndpointAddress & LIBUSB_ENDPOINT_DIR_MASK) == LIBUSB_ENDPOINT_IN) {
+                    bulkInEndpointFound = true;
+
+                } else {
+                    bulkOutEndpointFound = true;
+                }
+            }
+
+            if (!bulkInEndpointFound || !bulkOutEndpointFound) {
+                continue;
+            }
+
+            auto interfaceName = std::vector<unsigned char>(256, 0x00);
+            const auto interfaceNameLength = libusb_get_string_descriptor_ascii(
+                libUsbDeviceHandle,
+                interfaceDescriptor.iInterface,
+                interfaceName.data(),
+                static_cast<int>(interfaceName.size())
+            );
+
+            if (interfaceNameLength <= 0) {
+                continue;
+            }
+
+            if (
+                std::string(interfaceName.begin(), interfaceName.begin() + interfaceNameLength).find("CMSIS-DAP")
+                != std::string::npos
+            ) {
+                output = interfaceDescriptor.bInterfaceNumber;
+                break;
+            }
+        }
+
+        libusb_free_config_descriptor(configDescriptor);
+        return output;
+    }
+}
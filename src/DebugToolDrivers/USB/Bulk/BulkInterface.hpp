@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <optional>
+#include <libusb-1.0/libusb.h>
+
+#include "src/DebugToolDrivers/USB/Interface.hpp"
+
+namespace Bloom::Usb
+{
+    /**
+     * The BulkInterface implements communication with a pair of USB bulk endpoints (one IN, one OUT), via libusb.
+     *
+     * Unlike HID reports, bulk transfers are not of a fixed size, so data is sent as-is, without any padding.
+     */
+    class BulkInterface: public Interface
+    {
+    public:
+        /**
+         * The maximum packet size of the bulk IN endpoint. This is resolved upon initialisation.
+         *
+         * @return
+         */
+        [[nodiscard]] std::size_t getInputPacketSize() const {
+            return this->inputPacketSize;
+        }
+
+        /**
+         * The maximum packet size of the bulk OUT endpoint. This is resolved upon initialisation.
+         *
+         * @return
+         */
+        [[nodiscard]] std::size_t getOutputPacketSize() const {
+            return this->outputPacketSize;
+        }
+
+        /**
+         * The maximum size of a single transfer, in either direction. Read buffers are allocated to this size.
+         *
+         * This defaults to the smaller of the two endpoint packet sizes, upon initialisation. A transfer can span
+         * several packets, so the device may support much larger transfers (see
+         * CmsisDapInterface::queryPacketSize()).
+         *
+         * @return
+         */
+        [[nodiscard]] std::size_t getMaximumTransferSize() const {
+            return this->maximumTransferSize;
+        }
+
+        void setMaximumTransferSize(std::size_t maximumTransferSize) {
+            this->maximumTransferSize = maximumTransferSize;
+        }
+
+        /**
+         * Resolves the bulk endpoints from the active configuration descriptor, and claims the interface.
+         */
+        void init() override;
+
+        /**
+         * Reads a single transfer from the bulk IN endpoint.
+         *
+         * @param timeout
+         *  The maximum time to wait, in milliseconds. If set to 0, this method will block until a packet is received.
+         *
+         * @return
+         *  The data received, or an empty vector if the timeout was reached.
+         */
+        std::vector<unsigned char> read(unsigned int timeout = 0);
+
+        /**
+         * Writes the buffer to the bulk OUT endpoint.
+         *
+         * @param buffer
+         */
+        void write(const std::vector<unsigned char>& buffer);
+
+        /**
+         * Writes `length` bytes from `data` to the bulk OUT endpoint.
+         *
+         * @param data
+         * @param length
+         */
+        void write(const unsigned char* data, std::size_t length);
+
+        /**
+         * Searches the active configuration of the given device for a CMSIS-DAP v2 interface.
+         *
+         * As per the CMSIS-DAP specification, a CMSIS-DAP v2 interface is a vendor specific interface with a bulk
+         * OUT endpoint and a bulk IN endpoint, and an interface string that contains "CMSIS-DAP".
+         *
+         * @param libUsbDevice
+         * @param libUsbDeviceHandle
+         *
+         * @return
+         *  The interface number, if a CMSIS-DAP v2 interface was found. Otherwise, std::nullopt.
+         */
+        static std::optional<std::uint8_t> findCmsisDapInterfaceNumber(
+            libusb_device* libUsbDevice,
+            libusb_device_handle* libUsbDeviceHandle
+        );
+
+    private:
+        unsigned char inEndpointAddress = 0;
+        unsigned char outEndpointAddress = 0;
+
+        std::size_t inputPacketSize = 64;
+        std::size_t outputPacketSize = 64;
+        std::size_t maximumTransferSize = 64;
+    };
+}
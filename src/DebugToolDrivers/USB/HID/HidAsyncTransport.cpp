@@ -0,0 +1,281 @@
+#include "HidAsyncTransport.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "src/Logger/Logger.hpp"
+
+#include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+
+namespace Bloom::Usb
+{
+    using namespace Bloom::Exceptions;
+
+    HidAsyncTransport::HidAsyncTransport(
+        libusb_context* libUsbContext,
+        libusb_device_handle* libUsbDeviceHandle,
+        unsigned char inEndpointAddress,
+        unsigned char outEndpointAddress,
+        std::size_t inputReportSize,
+        std::size_t outputReportSize
+    )
+        : libUsbContext(libUsbContext)
+        , libUsbDeviceHandle(libUsbDeviceHandle)
+        , inEndpointAddress(inEndpointAddress)
+        , outEndpointAddress(outEndpointAddress)
+        , inputReportSize(inputReportSize)
+        , outputReportSize(outputReportSize)
+        , outBuffer(outputReportSize, 0x00)
+    {}
+
+    HidAsyncTransport::~HidAsyncTransport() {
+        this->stop();
+    }
+
+    void HidAsyncTransport::start() {
+        if (this->outTransfer != nullptr) {
+            return;
+        }
+
+        this->outTransfer = libusb_alloc_transfer(0);
+        if (this->outTransfer == nullptr) {
+            throw DeviceInitializationFailure("Failed to allocate libusb transfer for HID OUT endpoint");
+        }
+
+        libusb_fill_interrupt_transfer(
+            this->outTransfer,
+            this->libUsbDeviceHandle,
+            this->outEndpointAddress,
+            this->outBuffer.data(),
+            static_cast<int>(this->outBuffer.size()),
+            &HidAsyncTransport::onOutTransferComplete,
+            this,
+            HidAsyncTransport::OUT_TRANSFER_TIMEOUT
+        );
+
+        this->inBuffers.resize(
+            HidAsyncTransport::IN_TRANSFER_COUNT,
+            std::vector<unsigned char>(this->inputReportSize)
+        );
+
+        for (auto& inBuffer : this->inBuffers) {
+            auto* transfer = libusb_alloc_transfer(0);
+            if (transfer == nullptr) {
+                throw DeviceInitializationFailure("Failed to allocate libusb transfer for HID IN endpoint");
+            }
+
+            libusb_fill_interrupt_transfer(
+                transfer,
+                this->libUsbDeviceHandle,
+                this->inEndpointAddress,
+                inBuffer.data(),
+                static_cast<int>(inBuffer.size()),
+                &HidAsyncTransport::onInTransferComplete,
+                this,
+                0
+            );
+
+            this->inTransfers.push_back(transfer);
+        }
+
+        {
+            const auto lock = std::unique_lock(this->mutex);
+            this->stopping = false;
+        }
+
+        // The event thread must be running before we submit any transfers, so that they can be reaped on failure
+        this->eventThread = std::thread(&HidAsyncTransport::handleEvents, this);
+
+        {
+            const auto lock = std::unique_lock(this->mutex);
+
+            for (auto* transfer : this->inTransfers) {
+                if (!this->submitTransfer(transfer)) {
+                    throw DeviceInitializationFailure(
+                        "Failed to submit libusb transfer for HID IN endpoint - error code "
+                            + std::to_string(this->failureStatus.value_or(0))
+                    );
+                }
+            }
+        }
+    }
+
+    void HidAsyncTransport::stop() {
+        {
+            const auto lock = std::unique_lock(this->mutex);
+            this->stopping = true;
+
+            /*
+             * Completed transfers that have not been consumed are no longer submitted, so there's nothing to cancel
+             * for those. All others must be cancelled before they can be freed.
+             */
+            for (auto* transfer : this->inTransfers) {
+                if (
+                    std::find(this->completedInTransfers.begin(), this->completedInTransfers.end(), transfer)
+                    == this->completedInTransfers.end()
+                ) {
+                    libusb_cancel_transfer(transfer);
+                }
+            }
+
+            if (this->outTransfer != nullptr && !this->outTransferStatus.has_value()) {
+                libusb_cancel_transfer(this->outTransfer);
+            }
+
+            this->completedInTransfers.clear();
+        }
+
+        this->condition.notify_all();
+
+        // The event thread will exit once all cancelled transfers have been reaped
+        if (this->eventThread.joinable()) {
+            this->eventThread.join();
+        }
+
+        for (auto* transfer : this->inTransfers) {
+            libusb_free_transfer(transfer);
+        }
+
+        this->inTransfers.clear();
+        this->inBuffers.clear();
+
+        if (this->outTransfer != nullptr) {
+            libusb_free_transfer(this->outTransfer);
+            this->outTransfer = nullptr;
+        }
+    }
+
+    std::vector<unsigned char> HidAsyncTransport::readReport(unsigned int timeout) {
+        auto lock = std::unique_lock(this->mutex);
+
+        const auto predicate = [this] {
+            return !this->completedInTransfers.empty() || this->failureStatus.has_value() || this->stopping;
+        };
+
+        if (timeout == 0) {
+            this->condition.wait(lock, predicate);
+
+        } else if (!this->condition.wait_for(lock, std::chrono::milliseconds(timeout), predicate)) {
+            return {};
+        }
+
+        if (this->completedInTransfers.empty()) {
+            throw DeviceCommunicationFailure(
+                "Failed to read from HID device - transfer failed with status "
+                    + std::to_string(this->failureStatus.value_or(LIBUSB_TRANSFER_CANCELLED))
+            );
+        }
+
+        auto* transfer = this->completedInTransfers.front();
+        this->completedInTransfers.pop_front();
+
+        auto output = std::vector<unsigned char>(
+            transfer->buffer,
+            transfer->buffer + std::max(transfer->actual_length, 0)
+        );
+
+        // The transfer's buffer is free again, so we can put the transfer back in the ring
+        if (!this->stopping) {
+            this->submitTransfer(transfer);
+        }
+
+        return output;
+    }
+
+    void HidAsyncTransport::writeReport(const unsigned char* data, std::size_t length) {
+        if (length > this->outputReportSize) {
+            throw DeviceCommunicationFailure(
+                "Cannot send data via HID interface - data exceeds maximum packet size."
+            );
+        }
+
+        auto lock = std::unique_lock(this->mutex);
+
+        if (this->failureStatus.has_value() || this->stopping) {
+            throw DeviceCommunicationFailure("Failed to write data to HID interface - transport unavailable.");
+        }
+
+        std::copy(data, data + length, this->outBuffer.begin());
+        std::fill(this->outBuffer.begin() + static_cast<long>(length), this->outBuffer.end(), 0x00);
+
+        this->outTransferStatus = std::nullopt;
+        if (!this->submitTransfer(this->outTransfer)) {
+            throw DeviceCommunicationFailure("Failed to write data to HID interface.");
+        }
+
+        this->condition.wait(lock, [this] {
+            return this->outTransferStatus.has_value();
+        });
+
+        if (this->outTransferStatus != LIBUSB_TRANSFER_COMPLETED) {
+            Logger::debug(
+                "HID OUT transfer failed with status " + std::to_string(this->outTransferStatus.value())
+            );
+            throw DeviceCommunicationFailure("Failed to write data to HID interface.");
+        }
+    }
+
+    void HidAsyncTransport::handleEvents() {
+        auto timeout = timeval();
+        timeout.tv_sec = 0;
+        timeout.tv_usec = 100000;
+
+        while (true) {
+            {
+                const auto lock = std::unique_lock(this->mutex);
+                if (this->stopping && this->submittedTransfers == 0) {
+                    break;
+                }
+            }
+
+            libusb_handle_events_timeout_completed(this->libUsbContext, &timeout, nullptr);
+        }
+    }
+
+    bool HidAsyncTransport::submitTransfer(libusb_transfer* transfer) {
+        const auto libUsbStatusCode = libusb_submit_transfer(transfer);
+
+        if (libUsbStatusCode != 0) {
+            if (!this->failureStatus.has_value()) {
+                this->failureStatus = libUsbStatusCode;
+            }
+
+            this->condition.notify_all();
+            return false;
+        }
+
+        this->submittedTransfers++;
+        return true;
+    }
+
+    void LIBUSB_CALL HidAsyncTransport::onInTransferComplete(libusb_transfer* transfer) {
+        auto* transport = static_cast<HidAsyncTransport*>(transfer->user_data);
+
+        {
+            const auto lock = std::unique_lock(transport->mutex);
+            transport->submittedTransfers--;
+
+            if (transfer->status == LIBUSB_TRANSFER_COMPLETED && !transport->stopping) {
+                transport->completedInTransfers.push_back(transfer);
+
+            } else if (transfer->status != LIBUSB_TRANSFER_CANCELLED && !transport->failureStatus.has_value()) {
+                transport->failureStatus = transfer->status;
+            }
+        }
+
+        transport->condition.notify_all();
+    }
+
+    void LIBUSB_CALL HidAsyncTransport::onOutTransferComplete(libusb_transfer* transfer) {
+        auto* transport = static_cast<HidAsyncTransport*>(transfer->user_data);
+
+        {
+            const auto lock = std::unique_lock(transport->mutex);
+            transport->submittedTransfers--;
+            transport->outTransferStatus = transfer->status;
+        }
+
+        transport->condition.notify_all();
+    }
+}
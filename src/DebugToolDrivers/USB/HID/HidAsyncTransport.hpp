@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <libusb-1.0/libusb.h>
+
+namespace Bloom::Usb
+{
+    /**
+     * The HidAsyncTransport services the HID interrupt endpoints of a USB device via libusb's asynchronous transfer
+     * API, bypassing HIDAPI.
+     *
+     * A fixed set of IN transfers (each with its own report buffer) is kept submitted at all times. When an IN
+     * transfer completes, it's queued until the report is consumed via HidAsyncTransport::readReport(), after which
+     * the transfer (and its buffer) is resubmitted. A single OUT transfer, with its own report buffer, is used for
+     * all writes. The transfer buffers are allocated once, in HidAsyncTransport::start() - each report is copied out
+     * of its transfer buffer, into the vector returned by HidAsyncTransport::readReport().
+     *
+     * libusb events are handled on a dedicated thread. Readers are woken as soon as a report arrives, so there's no
+     * polling involved.
+     */
+    class HidAsyncTransport
+    {
+    public:
+        /**
+         * The number of IN transfers to keep submitted.
+         */
+        static constexpr std::size_t IN_TRANSFER_COUNT = 4;
+
+        /**
+         * The timeout for OUT transfers, in milliseconds.
+         */
+        static constexpr unsigned int OUT_TRANSFER_TIMEOUT = 5000;
+
+        HidAsyncTransport(
+            libusb_context* libUsbContext,
+            libusb_device_handle* libUsbDeviceHandle,
+            unsigned char inEndpointAddress,
+            unsigned char outEndpointAddress,
+            std::size_t inputReportSize,
+            std::size_t outputReportSize
+        );
+
+        ~HidAsyncTransport();
+
+        HidAsyncTransport(const HidAsyncTransport& other) = delete;
+        HidAsyncTransport(HidAsyncTransport&& other) = delete;
+
+        HidAsyncTransport& operator = (const HidAsyncTransport& other) = delete;
+        HidAsyncTransport& operator = (HidAsyncTransport&& other) = delete;
+
+        /**
+         * Submits the IN transfers and starts the event handling thread.
+         */
+        void start();
+
+        /**
+         * Cancels all pending transfers and stops the event handling thread.
+         */
+        void stop();
+
+        /**
+         * Waits for an IN report.
+         *
+         * @param timeout
+         *  The maximum time to wait, in milliseconds. If set to 0, this function will wait indefinitely.
+         *
+         * @return
+         *  The report data, or an empty vector if the timeout was reached.
+         */
+        std::vector<unsigned char> readReport(unsigned int timeout);
+
+        /**
+         * Writes a single OUT report and waits for the transfer to complete.
+         *
+         * @param data
+         * @param length
+         *  Must not exceed the output report size. Shorter reports are padded with zeros.
+         */
+        void writeReport(const unsigned char* data, std::size_t length);
+
+    private:
+        libusb_context* libUsbContext = nullptr;
+        libusb_device_handle* libUsbDeviceHandle = nullptr;
+        unsigned char inEndpointAddress = 0;
+        unsigned char outEndpointAddress = 0;
+        std::size_t inputReportSize = 0;
+        std::size_t outputReportSize = 0;
+
+        std::vector<libusb_transfer*> inTransfers;
+        std::vector<std::vector<unsigned char>> inBuffers;
+
+        libusb_transfer* outTransfer = nullptr;
+        std::vector<unsigned char> outBuffer;
+
+        std::thread eventThread;
+
+        /**
+         * Guards all members below.
+         */
+        std::mutex mutex;
+        std::condition_variable condition;
+
+        /**
+         * IN transfers that have completed, in order of completion, and whose reports are yet to be consumed.
+         */
+        std::deque<libusb_transfer*> completedInTransfers;
+
+        /**
+         * The number of transfers currently submitted to libusb.
+         */
+        std::size_t submittedTransfers = 0;
+
+        std::optional<libusb_transfer_status> outTransferStatus;
+
+        /**
+         * The status of the first failed transfer. Once set, all reads and writes will fail.
+         */
+        std::optional<int> failureStatus;
+
+        bool stopping = false;
+
+        /**
+         * Entry point for the event handling thread.
+         */
+        void handleEvents();
+
+        /**
+         * Submits the given transfer. Callers must hold this->mutex.
+         *
+         * @param transfer
+         * @return
+         *  True if the transfer was submitted, false otherwise (in which case, this->failureStatus will be set).
+         */
+        bool submitTransfer(libusb_transfer* transfer);
+
+        static void LIBUSB_CALL onInTransferComplete(libusb_transfer* transfer);
+        static void LIBUSB_CALL onOutTransferComplete(libusb_transfer* transfer);
+    };
+}
@@ -1,5 +1,7 @@
 #include "HidInterface.hpp"
 
+#include <algorithm>
+
 #include "src/Logger/Logger.hpp"
 
 #include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
@@ -14,6 +16,11 @@ namespace Bloom::Usb
             throw DeviceInitializationFailure("Cannot initialise interface without libusb device pointer.");
         }
 
+        if (this->asyncTransfersEnabled) {
+            this->initAsyncTransport();
+            return;
+        }
+
         hid_init();
         hid_device* hidDevice = nullptr;
 
@@ -38,6 +45,13 @@ namespace Bloom::Usb
     }
 
     void HidInterface::close() {
+        if (this->asyncTransport) {
+            this->asyncTransport->stop();
+            this->asyncTransport.reset();
+            Interface::close();
+            return;
+        }
+
         auto* hidDevice = this->getHidDevice();
 
         if (hidDevice != nullptr) {
@@ -52,6 +66,11 @@ namespace Bloom::Usb
     }
 
     std::vector<unsigned char> HidInterface::read(unsigned int timeout) {
+        if (this->asyncTransport) {
+            // Reports are queued by the transport as they arrive, so there's no need to wait for continuations
+            return this->asyncTransport->readReport(timeout);
+        }
+
         std::vector<unsigned char> output;
         auto readSize = this->getInputReportSize();
 
@@ -71,25 +90,50 @@ namespace Bloom::Usb
         return output;
     }
 
+    std::vector<unsigned char> HidInterface::readReport(unsigned int timeout) {
+        if (this->asyncTransport) {
+            return this->asyncTransport->readReport(timeout);
+        }
+
+        auto output = std::vector<unsigned char>(this->getInputReportSize());
+        output.resize(this->read(output.data(), output.size(), timeout));
+        return output;
+    }
+
     void HidInterface::write(std::vector<unsigned char>&& buffer) {
-        if (buffer.size() > this->getInputReportSize()) {
+        this->write(buffer.data(), buffer.size());
+    }
+
+    void HidInterface::write(const unsigned char* data, std::size_t length) {
+        if (length > this->getInputReportSize()) {
             throw DeviceCommunicationFailure(
                 "Cannot send data via HID interface - data exceeds maximum packet size."
             );
         }
 
-        if (buffer.size() < this->getInputReportSize()) {
+        if (this->asyncTransport) {
+            // The transport pads the report in its own buffer
+            this->asyncTransport->writeReport(data, length);
+            return;
+        }
+
+        if (length < this->getInputReportSize()) {
             /*
              * Every report we send via the USB HID interface should be of a fixed size.
-             * In the event of a report being too small, we just fill the buffer vector with 0.
+             * In the event of a report being too small, we pad it with 0, in our own report buffer. The buffer is
+             * only ever allocated once.
              */
-            buffer.resize(this->getInputReportSize(), 0);
+            this->outputReportBuffer.resize(this->getInputReportSize());
+            std::copy(data, data + length, this->outputReportBuffer.begin());
+            std::fill(this->outputReportBuffer.begin() + static_cast<long>(length), this->outputReportBuffer.end(), 0);
+
+            data = this->outputReportBuffer.data();
+            length = this->outputReportBuffer.size();
         }
 
         int transferred = 0;
-        const auto length = buffer.size();
 
-        if ((transferred = hid_write(this->getHidDevice(), buffer.data(), length)) != length) {
+        if ((transferred = hid_write(this->getHidDevice(), data, length)) != length) {
             Logger::debug("Attempted to write " + std::to_string(length)
                 + " bytes to HID interface. Bytes written: " + std::to_string(transferred));
             throw DeviceCommunicationFailure("Failed to write data to HID interface.");
@@ -112,6 +156,37 @@ namespace Bloom::Usb
         return static_cast<std::size_t>(transferred);
     }
 
+    void HidInterface::initAsyncTransport() {
+        if (this->libUsbDeviceHandle == nullptr || this->libUsbContext == nullptr) {
+            throw DeviceInitializationFailure(
+                "Cannot initialise asynchronous HID transport without libusb device handle and context."
+            );
+        }
+
+        const auto [inEndpoint, outEndpoint] = this->resolveEndpoints(LIBUSB_TRANSFER_TYPE_INTERRUPT);
+
+        if (inEndpoint.wMaxPacketSize < 1) {
+            throw DeviceInitializationFailure(
+                "Invalid interrupt endpoint packet size for HID interface " + std::to_string(this->getNumber())
+            );
+        }
+
+        this->claim();
+
+        this->setInputReportSize(static_cast<std::size_t>(inEndpoint.wMaxPacketSize));
+        this->asyncTransport = std::make_unique<HidAsyncTransport>(
+            this->libUsbContext,
+            this->libUsbDeviceHandle,
+            inEndpoint.bEndpointAddress,
+            outEndpoint.bEndpointAddress,
+            static_cast<std::size_t>(inEndpoint.wMaxPacketSize),
+            static_cast<std::size_t>(outEndpoint.wMaxPacketSize)
+        );
+
+        this->asyncTransport->start();
+        this->initialised = true;
+    }
+
     std::string HidInterface::getDevicePathByInterfaceNumber(const std::uint16_t& interfaceNumber) {
         hid_device_info* hidDeviceInfoList = hid_enumerate(
             this->getVendorId(),
@@ -3,8 +3,10 @@
 #include <cstdint>
 #include <string>
 #include <vector>
+#include <memory>
 
 #include "hidapi.hpp"
+#include "HidAsyncTransport.hpp"
 #include "src/DebugToolDrivers/USB/Interface.hpp"
 
 namespace Bloom::Usb
@@ -14,6 +16,9 @@ namespace Bloom::Usb
      *
      * Currently, this interface only supports single-report HID implementations. HID interfaces with
      * multiple reports will be supported as-and-when we need it.
+     *
+     * Alternatively, the interface can be serviced via libusb's asynchronous transfer API, bypassing HIDAPI. See
+     * HidInterface::setAsyncTransfersEnabled() for more.
      */
     class HidInterface: public Interface
     {
@@ -22,6 +27,25 @@ namespace Bloom::Usb
              return this->inputReportSize;
         }
 
+        /**
+         * Enables the asynchronous transfer mode. In this mode, the HID interface is claimed directly via libusb, and
+         * reports are transferred via a HidAsyncTransport, as opposed to HIDAPI.
+         *
+         * This removes the continuation wait from HidInterface::read() (each call returns a single report), and the
+         * per-report buffer allocations in HidInterface::write().
+         *
+         * Must be called before HidInterface::init(). Requires the libusb context of the device.
+         *
+         * @param enabled
+         */
+        void setAsyncTransfersEnabled(bool enabled) {
+            this->asyncTransfersEnabled = enabled;
+        }
+
+        void setLibUsbContext(libusb_context* libUsbContext) {
+            this->libUsbContext = libUsbContext;
+        }
+
         /**
          * Claims the USB HID interface and obtains a hid_device instance
          */
@@ -45,6 +69,20 @@ namespace Bloom::Usb
          */
         std::vector<unsigned char> read(unsigned int timeout = 0);
 
+        /**
+         * Reads a single HID report from the device.
+         *
+         * Unlike HidInterface::read(), this will not attempt to read any following reports. This is required when
+         * numerous responses are pending, as each response occupies its own report.
+         *
+         * If `timeout` is set to 0, this method will block until a report is received.
+         *
+         * @param timeout
+         *
+         * @return
+         */
+        std::vector<unsigned char> readReport(unsigned int timeout = 0);
+
         /**
          * Writes buffer to HID output endpoint.
          *
@@ -52,6 +90,17 @@ namespace Bloom::Usb
          */
         void write(std::vector<unsigned char>&& buffer);
 
+        /**
+         * Writes `length` bytes from `data` to the HID output endpoint, as a single report.
+         *
+         * If `length` is equal to the report size, the data is sent as-is, without being copied. Otherwise, the
+         * report is padded in an internal buffer.
+         *
+         * @param data
+         * @param length
+         */
+        void write(const unsigned char* data, std::size_t length);
+
         /**
          * Resolves a device path from a USB interface number.
          *
@@ -73,6 +122,14 @@ namespace Bloom::Usb
          */
         hid_device* hidDevice = nullptr;
 
+        bool asyncTransfersEnabled = false;
+        libusb_context* libUsbContext = nullptr;
+
+        /**
+         * Only used in the asynchronous transfer mode.
+         */
+        std::unique_ptr<HidAsyncTransport> asyncTransport;
+
         /**
          * All HID reports have a fixed report length. This means that every packet
          * we send or receive to/from an HID endpoint must be equal to the report length in size.
@@ -82,6 +139,11 @@ namespace Bloom::Usb
          */
         std::size_t inputReportSize = 64;
 
+        /**
+         * Used to pad short reports, in HidInterface::write().
+         */
+        std::vector<unsigned char> outputReportBuffer;
+
         void setHidDevice(hid_device* hidDevice) {
             this->hidDevice = hidDevice;
         }
@@ -90,6 +152,12 @@ namespace Bloom::Usb
             this->inputReportSize = inputReportSize;
         }
 
+        /**
+         * Claims the interface via libusb, resolves its interrupt endpoints from the active configuration descriptor
+         * and starts the asynchronous transport.
+         */
+        void initAsyncTransport();
+
         /**
          * Reads a maximum of `maxLength` bytes into `buffer`, from the HID input endpoint.
          *
@@ -1,6 +1,7 @@
 #include "Interface.hpp"
 
 #include <libusb-1.0/libusb.h>
+#include <optional>
 
 #include "src/TargetController/Exceptions/DeviceFailure.hpp"
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
@@ -74,6 +75,63 @@ namespace Bloom::Usb
         }
     }
 
+    std::pair<libusb_endpoint_descriptor, libusb_endpoint_descriptor> Interface::resolveEndpoints(
+        libusb_transfer_type transferType
+    ) {
+        libusb_config_descriptor* configDescriptor = nullptr;
+        const auto libUsbStatusCode = libusb_get_active_config_descriptor(this->libUsbDevice, &configDescriptor);
+
+        if (libUsbStatusCode < 0) {
+            throw DeviceInitializationFailure(
+                "Failed to obtain USB configuration descriptor - error code " + std::to_string(libUsbStatusCode)
+                    + " returned."
+            );
+        }
+
+        auto inEndpoint = std::optional<libusb_endpoint_descriptor>();
+        auto outEndpoint = std::optional<libusb_endpoint_descriptor>();
+
+        for (auto interfaceIndex = 0; interfaceIndex < configDescriptor->bNumInterfaces; ++interfaceIndex) {
+            const auto& usbInterface = configDescriptor->interface[interfaceIndex];
+            if (usbInterface.num_altsetting < 1 || usbInterface.altsetting[0].bInterfaceNumber != this->getNumber()) {
+                continue;
+            }
+
+            const auto& interfaceDescriptor = usbInterface.altsetting[0];
+            for (auto endpointIndex = 0; endpointIndex < interfaceDescriptor.bNumEndpoints; ++endpointIndex) {
+                const auto& endpoint = interfaceDescriptor.endpoint[endpointIndex];
+
+                if ((endpoint.bmAttributes & LIBUSB_TRANSFER_TYPE_MASK) != transferType) {
+                    continue;
+                }
+
+                if ((endpoint.bEndpointAddress & LIBUSB_ENDPOINT_DIR_MASK) == LIBUSB_ENDPOINT_IN) {
+                    if (!inEndpoint.has_value()) {
+                        inEndpoint = endpoint;
+                    }
+
+                } else if (!outEndpoint.has_value()) {
+                    outEndpoint = endpoint;
+                }
+            }
+        }
+
+        libusb_free_config_descriptor(configDescriptor);
+
+        if (!inEndpoint.has_value() || !outEndpoint.has_value()) {
+            const auto transferTypeName = transferType == LIBUSB_TRANSFER_TYPE_BULK ? std::string("bulk")
+                : transferType == LIBUSB_TRANSFER_TYPE_INTERRUPT ? std::string("interrupt")
+                : "type " + std::to_string(transferType);
+
+            throw DeviceInitializationFailure(
+                "Failed to resolve " + transferTypeName + " endpoints for USB interface "
+                    + std::to_string(this->getNumber())
+            );
+        }
+
+        return {inEndpoint.value(), outEndpoint.value()};
+    }
+
     int Interface::read(unsigned char* buffer, unsigned char endPoint, size_t length, size_t timeout) {
         int totalTransferred = 0;
         int transferred = 0;
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <libusb-1.0/libusb.h>
 #include <string>
+#include <utility>
 
 #include "UsbDevice.hpp"
 
@@ -109,6 +110,20 @@ namespace Bloom::Usb
         virtual void write(unsigned char* buffer, unsigned char endPoint, int length);
 
     protected:
+        /**
+         * Finds the first IN and first OUT endpoint, of the given transfer type, on this interface.
+         *
+         * This function will throw an exception if either endpoint cannot be found.
+         *
+         * @param transferType
+         *
+         * @return
+         *  The IN endpoint descriptor, followed by the OUT endpoint descriptor.
+         */
+        std::pair<libusb_endpoint_descriptor, libusb_endpoint_descriptor> resolveEndpoints(
+            libusb_transfer_type transferType
+        );
+
         libusb_device* libUsbDevice = nullptr;
         libusb_device_handle* libUsbDeviceHandle = nullptr;
 
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+namespace Bloom
+{
+    /**
+     * A minimal allocator that recycles single-object allocations, via a shared free list.
+     *
+     * Memory released via PoolAllocator::deallocate() is kept on the free list (up to MAX_FREE_BLOCKS blocks) and
+     * handed out again on the next allocation, avoiding a trip to the heap for objects that are created and destroyed
+     * at a high rate. Allocations of more than one object bypass the pool.
+     *
+     * This is intended for use with std::allocate_shared(), where the allocator will be rebound to the shared
+     * pointer's internal control block type - meaning the object and control block are recycled together.
+     *
+     * @tparam Type
+     */
+    template<typename Type>
+    class PoolAllocator
+    {
+    public:
+        using value_type = Type;
+
+        /**
+         * The maximum number of free blocks to retain. Anything above this will be released back to the heap.
+         */
+        static constexpr std::size_t MAX_FREE_BLOCKS = 64;
+
+        PoolAllocator() = default;
+
+        template<typename OtherType>
+        PoolAllocator(const PoolAllocator<OtherType>&) noexcept {}
+
+        Type* allocate(std::size_t count) {
+            if (count == 1) {
+                auto& freeList = PoolAllocator::getFreeList();
+                auto lock = std::unique_lock(freeList.mutex);
+
+                if (!freeList.blocks.empty()) {
+                    auto* block = freeList.blocks.back();
+                    freeList.blocks.pop_back();
+                    return block;
+                }
+            }
+
+            return std::allocator<Type>().allocate(count);
+        }
+
+        void deallocate(Type* block, std::size_t count) {
+            if (count == 1) {
+                auto& freeList = PoolAllocator::getFreeList();
+                auto lock = std::unique_lock(freeList.mutex);
+
+                if (freeList.blocks.size() < PoolAllocator::MAX_FREE_BLOCKS) {
+                    freeList.blocks.push_back(block);
+                    return;
+                }
+            }
+
+            std::allocator<Type>().deallocate(block, count);
+        }
+
+        template<typename OtherType>
+        bool operator == (const PoolAllocator<OtherType>&) const noexcept {
+            return true;
+        }
+
+        template<typename OtherType>
+        bool operator != (const PoolAllocator<OtherType>&) const noexcept {
+            return false;
+        }
+
+    private:
+        struct FreeList
+        {
+            std::vector<Type*> blocks;
+            std::mutex mutex;
+        };
+
+        /**
+         * The free list is intentionally leaked. Objects holding pooled allocations (such as shared pointers held
+         * in other static objects) may outlive any static free list, and would otherwise be released into a
+         * destroyed vector during static destruction.
+         *
+         * @return
+         */
+        static FreeList& getFreeList() {
+            static auto* freeList = new FreeList();
+            return *freeList;
+        }
+    };
+}
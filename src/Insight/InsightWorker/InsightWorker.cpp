@@ -25,6 +25,13 @@ namespace Bloom
         Logger::debug("Starting InsightWorker thread");
         EventManager::registerListener(this->eventListener);
 
+        /*
+         * Commands issued by Insight should not hold up commands issued by the user's debugging actions (via GDB).
+         */
+        this->targetControllerConsole.setCommandPriority(
+            TargetController::Commands::CommandPriority::UI_REFRESH
+        );
+
         this->eventListener->registerCallbackForEventType<Events::TargetControllerStateChanged>(
             std::bind(&InsightWorker::onTargetControllerStateChangedEvent, this, std::placeholders::_1)
         );
@@ -5,13 +5,22 @@ namespace Bloom
     using TargetController::TargetControllerConsole;
 
     void ReadTargetMemory::run(TargetControllerConsole& targetControllerConsole) {
-        emit this->targetMemoryRead(
-            targetControllerConsole.readMemory(
-                this->memoryType,
-                this->startAddress,
-                this->size,
-                this->excludedAddressRanges
-            )
-        );
+        auto buffer = Targets::TargetMemoryBuffer();
+        auto stackPointer = std::uint32_t(0);
+
+        auto batch = targetControllerConsole.batch();
+        batch.readMemory(this->memoryType, this->startAddress, this->size, buffer, this->excludedAddressRanges);
+
+        if (this->readStackPointer) {
+            batch.getStackPointer(stackPointer);
+        }
+
+        batch.send();
+
+        emit this->targetMemoryRead(buffer);
+
+        if (this->readStackPointer) {
+            emit this->stackPointerRead(stackPointer);
+        }
     }
 }
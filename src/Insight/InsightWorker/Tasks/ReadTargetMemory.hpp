@@ -13,19 +13,32 @@ namespace Bloom
         Q_OBJECT
 
     public:
+        /**
+         * @param memoryType
+         * @param startAddress
+         * @param size
+         * @param excludedAddressRanges
+         *
+         * @param readStackPointer
+         *  If true, the stack pointer will be read along with the memory, in a single CommandBatch, and emitted via
+         *  the stackPointerRead() signal.
+         */
         ReadTargetMemory(
             Targets::TargetMemoryType memoryType,
             std::uint32_t startAddress,
             std::uint32_t size,
-            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {},
+            bool readStackPointer = false
         )
             : memoryType(memoryType)
             , startAddress(startAddress)
             , size(size)
-            , excludedAddressRanges(excludedAddressRanges) {}
+            , excludedAddressRanges(excludedAddressRanges)
+            , readStackPointer(readStackPointer) {}
 
     signals:
         void targetMemoryRead(Targets::TargetMemoryBuffer buffer);
+        void stackPointerRead(std::uint32_t stackPointer);
 
     protected:
         void run(TargetController::TargetControllerConsole& targetControllerConsole) override;
@@ -35,5 +48,6 @@ namespace Bloom
         std::uint32_t startAddress;
         std::uint32_t size;
         std::set<Targets::TargetMemoryAddressRange> excludedAddressRanges;
+        bool readStackPointer = false;
     };
 }
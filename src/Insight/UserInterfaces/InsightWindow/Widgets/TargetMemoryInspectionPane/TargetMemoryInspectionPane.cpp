@@ -7,7 +7,6 @@
 #include "src/Insight/UserInterfaces/InsightWindow/Widgets/Label.hpp"
 
 #include "src/Insight/InsightWorker/Tasks/ReadTargetMemory.hpp"
-#include "src/Insight/InsightWorker/Tasks/ReadStackPointer.hpp"
 
 #include "src/Helpers/Paths.hpp"
 #include "src/Exceptions/Exception.hpp"
@@ -123,11 +122,13 @@ namespace Bloom::Widgets
             }
         );
 
+        // If this is RAM, the stack pointer is read along with the memory, in the same batch
         auto* readMemoryTask = new ReadTargetMemory(
             this->targetMemoryDescriptor.type,
             this->targetMemoryDescriptor.addressRange.startAddress,
             this->targetMemoryDescriptor.size(),
-            excludedAddressRanges
+            excludedAddressRanges,
+            this->targetMemoryDescriptor.type == Targets::TargetMemoryType::RAM
         );
 
         QObject::connect(
@@ -136,21 +137,15 @@ namespace Bloom::Widgets
             this,
             [this] (const Targets::TargetMemoryBuffer& buffer) {
                 this->onMemoryRead(buffer);
+            }
+        );
 
-                // Refresh the stack pointer if this is RAM.
-                if (this->targetMemoryDescriptor.type == Targets::TargetMemoryType::RAM) {
-                    auto* readStackPointerTask = new ReadStackPointer();
-                    QObject::connect(
-                        readStackPointerTask,
-                        &ReadStackPointer::stackPointerRead,
-                        this,
-                        [this] (std::uint32_t stackPointer) {
-                            this->hexViewerWidget->setStackPointer(stackPointer);
-                        }
-                    );
-
-                    this->insightWorker.queueTask(readStackPointerTask);
-                }
+        QObject::connect(
+            readMemoryTask,
+            &ReadTargetMemory::stackPointerRead,
+            this,
+            [this] (std::uint32_t stackPointer) {
+                this->hexViewerWidget->setStackPointer(stackPointer);
             }
         );
 
@@ -0,0 +1,151 @@
+#include "CommandBatchBuilder.hpp"
+
+// Commands
+#include "Commands/GetTargetState.hpp"
+#include "Commands/ReadTargetRegisters.hpp"
+#include "Commands/WriteTargetRegisters.hpp"
+#include "Commands/ReadTargetMemory.hpp"
+#include "Commands/WriteTargetMemory.hpp"
+#include "Commands/SetTargetProgramCounter.hpp"
+#include "Commands/GetTargetPinStates.hpp"
+#include "Commands/GetTargetStackPointer.hpp"
+#include "Commands/GetTargetProgramCounter.hpp"
+
+#include "Responses/Error.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::TargetController
+{
+    using Commands::GetTargetState;
+    using Commands::ReadTargetRegisters;
+    using Commands::WriteTargetRegisters;
+    using Commands::ReadTargetMemory;
+    using Commands::WriteTargetMemory;
+    using Commands::SetTargetProgramCounter;
+    using Commands::GetTargetPinStates;
+    using Commands::GetTargetStackPointer;
+    using Commands::GetTargetProgramCounter;
+
+    using Targets::TargetState;
+
+    using Targets::TargetRegisters;
+    using Targets::TargetRegisterDescriptors;
+
+    using Targets::TargetMemoryType;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetMemoryBuffer;
+
+    using Targets::TargetPinStateMappingType;
+
+    CommandBatchBuilder& CommandBatchBuilder::getTargetState(TargetState& targetState) {
+        return this->addCommand<GetTargetState>(
+            std::make_unique<GetTargetState>(),
+            [&targetState] (Responses::TargetState& response) {
+                targetState = response.targetState;
+            }
+        );
+    }
+
+    CommandBatchBuilder& CommandBatchBuilder::readRegisters(
+        const TargetRegisterDescriptors& descriptors,
+        TargetRegisters& registers
+    ) {
+        return this->addCommand<ReadTargetRegisters>(
+            std::make_unique<ReadTargetRegisters>(descriptors),
+            [&registers] (Responses::TargetRegistersRead& response) {
+                registers = std::move(response.registers);
+            }
+        );
+    }
+
+    CommandBatchBuilder& CommandBatchBuilder::writeRegisters(const TargetRegisters& registers) {
+        return this->addCommand<WriteTargetRegisters>(std::make_unique<WriteTargetRegisters>(registers));
+    }
+
+    CommandBatchBuilder& CommandBatchBuilder::readMemory(
+        TargetMemoryType memoryType,
+        std::uint32_t startAddress,
+        std::uint32_t bytes,
+        TargetMemoryBuffer& buffer,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        return this->addCommand<ReadTargetMemory>(
+            std::make_unique<ReadTargetMemory>(memoryType, startAddress, bytes, excludedAddressRanges),
+            [&buffer] (Responses::TargetMemoryRead& response) {
+                buffer = std::move(response.data);
+            }
+        );
+    }
+
+    CommandBatchBuilder& CommandBatchBuilder::writeMemory(
+        TargetMemoryType memoryType,
+        std::uint32_t startAddress,
+        const TargetMemoryBuffer& buffer
+    ) {
+        return this->addCommand<WriteTargetMemory>(
+            std::make_unique<WriteTargetMemory>(memoryType, startAddress, buffer)
+        );
+    }
+
+    CommandBatchBuilder& CommandBatchBuilder::getProgramCounter(std::uint32_t& programCounter) {
+        return this->addCommand<GetTargetProgramCounter>(
+            std::make_unique<GetTargetProgramCounter>(),
+            [&programCounter] (Responses::TargetProgramCounter& response) {
+                programCounter = response.programCounter;
+            }
+        );
+    }
+
+    CommandBatchBuilder& CommandBatchBuilder::setProgramCounter(std::uint32_t address) {
+        return this->addCommand<SetTargetProgramCounter>(std::make_unique<SetTargetProgramCounter>(address));
+    }
+
+    CommandBatchBuilder& CommandBatchBuilder::getStackPointer(std::uint32_t& stackPointer) {
+        return this->addCommand<GetTargetStackPointer>(
+            std::make_unique<GetTargetStackPointer>(),
+            [&stackPointer] (Responses::TargetStackPointer& response) {
+                stackPointer = response.stackPointer;
+            }
+        );
+    }
+
+    CommandBatchBuilder& CommandBatchBuilder::getPinStates(int variantId, TargetPinStateMappingType& pinStates) {
+        return this->addCommand<GetTargetPinStates>(
+            std::make_unique<GetTargetPinStates>(variantId),
+            [&pinStates] (Responses::TargetPinStates& response) {
+                pinStates = std::move(response.pinStatesByNumber);
+            }
+        );
+    }
+
+    void CommandBatchBuilder::send() {
+        if (this->batch->commands.empty()) {
+            return;
+        }
+
+        auto batchResponse = this->commandManager.sendCommandAndWaitForResponse(
+            std::move(this->batch),
+            this->timeout
+        );
+        this->batch = std::make_unique<Commands::CommandBatch>();
+
+        auto& responses = batchResponse->responses;
+
+        if (responses.size() != this->responseHandlers.size()) {
+            throw Exceptions::Exception("Unexpected number of responses to CommandBatch command");
+        }
+
+        for (std::size_t i = 0; i < responses.size(); ++i) {
+            auto& response = *(responses[i]);
+
+            if (response.getType() == Responses::ResponseType::ERROR) {
+                throw Exceptions::Exception(dynamic_cast<Responses::Error&>(response).errorMessage);
+            }
+
+            this->responseHandlers[i](response);
+        }
+
+        this->responseHandlers.clear();
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <set>
+#include <functional>
+#include <chrono>
+
+#include "CommandManager.hpp"
+
+#include "Commands/CommandBatch.hpp"
+#include "Responses/Response.hpp"
+
+#include "src/Targets/TargetState.hpp"
+#include "src/Targets/TargetRegister.hpp"
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetPinDescriptor.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * The CommandBatchBuilder provides a fluent interface for constructing and issuing a CommandBatch command.
+     *
+     * Each member function queues a command in the batch and records where the result should be written to. None
+     * of the commands are issued until CommandBatchBuilder::send() is called, at which point the entire batch is
+     * sent to the TargetController in a single command.
+     *
+     * For example:
+     *
+     *  auto programCounter = std::uint32_t(0);
+     *  auto stackPointer = std::uint32_t(0);
+     *  auto registers = Targets::TargetRegisters();
+     *
+     *  targetControllerConsole.batch()
+     *      .getProgramCounter(programCounter)
+     *      .getStackPointer(stackPointer)
+     *      .readRegisters(descriptors, registers)
+     *      .send();
+     *
+     * All output references must remain valid until send() returns.
+     *
+     * Instances of this class should be obtained via TargetControllerConsole::batch().
+     */
+    class CommandBatchBuilder
+    {
+    public:
+        CommandBatchBuilder(CommandManager& commandManager, std::chrono::milliseconds timeout)
+            : commandManager(commandManager)
+            , timeout(timeout)
+        {}
+
+        CommandBatchBuilder& getTargetState(Targets::TargetState& targetState);
+
+        CommandBatchBuilder& readRegisters(
+            const Targets::TargetRegisterDescriptors& descriptors,
+            Targets::TargetRegisters& registers
+        );
+
+        CommandBatchBuilder& writeRegisters(const Targets::TargetRegisters& registers);
+
+        CommandBatchBuilder& readMemory(
+            Targets::TargetMemoryType memoryType,
+            std::uint32_t startAddress,
+            std::uint32_t bytes,
+            Targets::TargetMemoryBuffer& buffer,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {}
+        );
+
+        CommandBatchBuilder& writeMemory(
+            Targets::TargetMemoryType memoryType,
+            std::uint32_t startAddress,
+            const Targets::TargetMemoryBuffer& buffer
+        );
+
+        CommandBatchBuilder& getProgramCounter(std::uint32_t& programCounter);
+
+        CommandBatchBuilder& setProgramCounter(std::uint32_t address);
+
+        CommandBatchBuilder& getStackPointer(std::uint32_t& stackPointer);
+
+        CommandBatchBuilder& getPinStates(int variantId, Targets::TargetPinStateMappingType& pinStates);
+
+        /**
+         * Issues the batch to the TargetController and waits for the responses. Results are written to the output
+         * references provided when the commands were queued.
+         *
+         * If any of the commands in the batch fail, an exception will be thrown with the error message of the first
+         * failed command. Results of commands that precede the failed command will have been written.
+         */
+        void send();
+
+    private:
+        CommandManager& commandManager;
+        std::chrono::milliseconds timeout;
+
+        std::unique_ptr<Commands::CommandBatch> batch = std::make_unique<Commands::CommandBatch>();
+
+        /**
+         * Response handlers for each command in the batch, in the same order as the commands.
+         */
+        std::vector<std::function<void(Responses::Response&)>> responseHandlers;
+
+        template<class CommandType>
+            requires std::is_base_of_v<Commands::Command, CommandType>
+        CommandBatchBuilder& addCommand(
+            std::unique_ptr<CommandType> command,
+            std::function<void(typename CommandType::SuccessResponseType&)> responseHandler = nullptr
+        ) {
+            using SuccessResponseType = typename CommandType::SuccessResponseType;
+
+            this->batch->commands.emplace_back(std::move(command));
+            this->responseHandlers.emplace_back(
+                [responseHandler] (Responses::Response& response) {
+                    if (responseHandler) {
+                        responseHandler(dynamic_cast<SuccessResponseType&>(response));
+                    }
+                }
+            );
+
+            return *this;
+        }
+    };
+}
@@ -5,11 +5,10 @@
 #include <optional>
 
 #include "Commands/Command.hpp"
+#include "Commands/CommandPriority.hpp"
 #include "Responses/Response.hpp"
-#include "Responses/Error.hpp"
 #include "TargetControllerComponent.hpp"
-
-#include "src/Exceptions/Exception.hpp"
+#include "PendingResponse.hpp"
 
 #include "src/Logger/Logger.hpp"
 
@@ -18,58 +17,61 @@ namespace Bloom::TargetController
     class CommandManager
     {
     public:
+        /**
+         * Sets the priority to be assigned to all commands issued via this CommandManager.
+         *
+         * @param priority
+         */
+        void setCommandPriority(Commands::CommandPriority priority) {
+            this->commandPriority = priority;
+        }
+
+        /**
+         * Issues the command to the TargetController, without waiting for a response.
+         *
+         * @tparam CommandType
+         *
+         * @param command
+         * @param timeout
+         *  The maximum amount of time to wait for the response, from this point.
+         *
+         * @return
+         *  A PendingResponse, for collecting the response at a later point.
+         */
         template<class CommandType>
             requires
                 std::is_base_of_v<Commands::Command, CommandType>
                 && std::is_base_of_v<Responses::Response, typename CommandType::SuccessResponseType>
-        auto sendCommandAndWaitForResponse(
+        PendingResponse<CommandType> sendCommand(
             std::unique_ptr<CommandType> command,
             std::chrono::milliseconds timeout
         ) {
-            using SuccessResponseType = typename CommandType::SuccessResponseType;
-
             const auto commandId = command->id;
+            command->priority = this->commandPriority;
+
             Logger::debug(
                 "Issuing " + CommandType::name + " command (ID: " + std::to_string(commandId) + ") to TargetController"
             );
 
-            TargetControllerComponent::registerCommand(std::move(command));
-
-            auto optionalResponse = TargetControllerComponent::waitForResponse(commandId, timeout);
-
-            if (!optionalResponse.has_value()) {
-                Logger::debug(
-                    "Timed out whilst waiting for TargetController to respond to " + CommandType::name + " command"
-                );
-                throw Exceptions::Exception("Command timed out");
-            }
-
-            auto& response = optionalResponse.value();
-
-            if (response->getType() == Responses::ResponseType::ERROR) {
-                const auto errorResponse = dynamic_cast<Responses::Error*>(response.get());
-
-                Logger::debug(
-                    "TargetController returned error in response to " + CommandType::name + " command (ID: "
-                        + std::to_string(commandId) + "). Error: " + errorResponse->errorMessage
-                );
-                throw Exceptions::Exception(errorResponse->errorMessage);
-            }
-
-            Logger::debug(
-                "Delivering response for " + CommandType::name + " command (ID: " + std::to_string(commandId) + ")"
+            return PendingResponse<CommandType>(
+                commandId,
+                TargetControllerComponent::registerCommand(std::move(command)),
+                timeout
             );
+        }
 
-            // Only downcast if the command's SuccessResponseType is not the generic Response type.
-            if constexpr (!std::is_same_v<SuccessResponseType, Responses::Response>) {
-                assert(response->getType() == SuccessResponseType::type);
-                return std::unique_ptr<SuccessResponseType>(
-                    dynamic_cast<SuccessResponseType*>(response.release())
-                );
-
-            } else {
-                return std::move(response);
-            }
+        template<class CommandType>
+            requires
+                std::is_base_of_v<Commands::Command, CommandType>
+                && std::is_base_of_v<Responses::Response, typename CommandType::SuccessResponseType>
+        auto sendCommandAndWaitForResponse(
+            std::unique_ptr<CommandType> command,
+            std::chrono::milliseconds timeout
+        ) {
+            return this->sendCommand(std::move(command), timeout).get();
         }
+
+    private:
+        Commands::CommandPriority commandPriority = Commands::CommandPriority::INTERACTIVE_DEBUG;
     };
 }
@@ -5,6 +5,7 @@
 #include <cstdint>
 
 #include "CommandTypes.hpp"
+#include "CommandPriority.hpp"
 
 #include "src/TargetController/Responses/Response.hpp"
 
@@ -19,6 +20,7 @@ namespace Bloom::TargetController::Commands
         using SuccessResponseType = Responses::Response;
 
         CommandIdType id = ++(Command::lastCommandId);
+        CommandPriority priority = CommandPriority::INTERACTIVE_DEBUG;
 
         static constexpr CommandType type = CommandType::GENERIC;
         static inline const std::string name = "GenericCommand";
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/CommandBatchResponses.hpp"
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * The CommandBatch command carries an ordered collection of other commands, which will be processed by the
+     * TargetController in a single pass. This allows callers to issue multiple commands for the cost of a single
+     * command queue round trip.
+     *
+     * Each command in the batch is processed as if it had been issued individually (meaning all target state checks
+     * are performed per command). A failure in one command will not prevent the processing of subsequent commands
+     * in the batch - the failed command will be paired with an Error response.
+     *
+     * The CommandBatchResponses response will hold a response for each command in the batch, in the same order as
+     * the commands.
+     *
+     * Components within Bloom should not need to construct these commands directly - see
+     * TargetControllerConsole::batch() and the CommandBatchBuilder class.
+     */
+    class CommandBatch: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::CommandBatchResponses;
+
+        static constexpr CommandType type = CommandType::COMMAND_BATCH;
+        static inline const std::string name = "CommandBatch";
+
+        std::vector<std::unique_ptr<Command>> commands;
+
+        CommandBatch() = default;
+
+        [[nodiscard]] CommandType getType() const override {
+            return CommandBatch::type;
+        }
+
+        /*
+         * The target state requirements of each command in the batch are checked just before the command is
+         * processed, as preceding commands in the batch may alter the target's state.
+         */
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return false;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Bloom::TargetController::Commands
+{
+    /**
+     * Commands are serviced by the TargetController in order of priority. Commands of equal priority are serviced
+     * in the order in which they were issued.
+     *
+     * The enum values are ordered from lowest to highest priority.
+     */
+    enum class CommandPriority: std::uint8_t
+    {
+        /**
+         * For commands that are not time sensitive.
+         */
+        BACKGROUND,
+
+        /**
+         * For commands issued to refresh a user interface (e.g. Insight).
+         */
+        UI_REFRESH,
+
+        /**
+         * For commands issued in direct response to the user's debugging actions, such as stepping or resuming
+         * execution, via GDB. This is the default priority.
+         */
+        INTERACTIVE_DEBUG,
+    };
+}
@@ -26,5 +26,6 @@ namespace Bloom::TargetController::Commands
         GET_TARGET_PROGRAM_COUNTER,
         ENABLE_PROGRAMMING_MODE,
         DISABLE_PROGRAMMING_MODE,
+        COMMAND_BATCH,
     };
 }
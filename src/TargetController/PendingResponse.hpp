@@ -0,0 +1,206 @@
+#pragma once
+
+#include <memory>
+#include <chrono>
+#include <cassert>
+#include <functional>
+
+#include "Commands/Command.hpp"
+#include "Responses/Response.hpp"
+#include "Responses/Error.hpp"
+#include "ResponseSlot.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A PendingResponse represents the outstanding response to a command that has been issued to the
+     * TargetController. It allows the issuer to carry on with other work whilst the TargetController services the
+     * command, and to collect the response at a later point, via PendingResponse::get(). Issuers that wait on other
+     * events (such as socket I/O) can be notified of the response via PendingResponse::setCompletionCallback().
+     *
+     * If a PendingResponse is destroyed before its response is collected, the command will be cancelled. See
+     * PendingResponse::cancel() for more.
+     *
+     * Instances of this class should be obtained via CommandManager::sendCommand() or the asynchronous member
+     * functions of the TargetControllerConsole.
+     *
+     * @tparam CommandType
+     */
+    template<class CommandType>
+        requires
+            std::is_base_of_v<Commands::Command, CommandType>
+            && std::is_base_of_v<Responses::Response, typename CommandType::SuccessResponseType>
+    class PendingResponse
+    {
+    public:
+        using SuccessResponseType = typename CommandType::SuccessResponseType;
+
+        /**
+         * @param commandId
+         *  The ID of the issued command.
+         *
+         * @param responseSlot
+         *  The slot to which the TargetController will deliver the response.
+         *
+         * @param timeout
+         *  The maximum amount of time we should wait for the response, from the point at which the command was
+         *  issued.
+         */
+        PendingResponse(
+            Commands::CommandIdType commandId,
+            std::shared_ptr<ResponseSlot> responseSlot,
+            std::chrono::milliseconds timeout
+        )
+            : commandId(commandId)
+            , responseSlot(std::move(responseSlot))
+            , deadline(std::chrono::steady_clock::now() + timeout)
+        {}
+
+        ~PendingResponse() {
+            if (!this->resolved) {
+                this->cancel();
+            }
+        }
+
+        PendingResponse(const PendingResponse& other) = delete;
+        PendingResponse& operator = (const PendingResponse& other) = delete;
+
+        PendingResponse(PendingResponse&& other) noexcept
+            : commandId(other.commandId)
+            , responseSlot(std::move(other.responseSlot))
+            , deadline(other.deadline)
+            , resolved(other.resolved)
+        {
+            other.resolved = true;
+        }
+
+        PendingResponse& operator = (PendingResponse&& other) = delete;
+
+        [[nodiscard]] Commands::CommandIdType getCommandId() const {
+            return this->commandId;
+        }
+
+        [[nodiscard]] std::chrono::steady_clock::time_point getDeadline() const {
+            return this->deadline;
+        }
+
+        /**
+         * Sets a callback to be invoked once the TargetController has responded to the command. The response
+         * should then be collected via PendingResponse::get(), which will not block.
+         *
+         * The callback is invoked from the TargetController's thread (or the calling thread, if the response has
+         * already arrived). See ResponseSlot::setCompletionCallback() for the constraints on the callback.
+         *
+         * @param callback
+         */
+        void setCompletionCallback(std::function<void(void)> callback) {
+            if (this->resolved) {
+                throw Exceptions::Exception(
+                    "Command response has already been collected, or the command was cancelled"
+                );
+            }
+
+            this->responseSlot->setCompletionCallback(std::move(callback));
+        }
+
+        /**
+         * Checks if the TargetController has responded to the command, without blocking.
+         *
+         * @return
+         */
+        [[nodiscard]] bool isReady() const {
+            return !this->resolved && this->responseSlot->isResponseAvailable();
+        }
+
+        /**
+         * Waits for the TargetController's response to the command, until the timeout (given at construction) has
+         * been reached.
+         *
+         * This function will throw an exception if the timeout is reached, the TargetController responds with an
+         * error, or the command has been cancelled. It can only be called once.
+         *
+         * @return
+         */
+        auto get() {
+            if (this->resolved) {
+                throw Exceptions::Exception(
+                    "Command response has already been collected, or the command was cancelled"
+                );
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            auto optionalResponse = this->responseSlot->waitForResponse(
+                this->deadline > now
+                    ? std::chrono::duration_cast<std::chrono::milliseconds>(this->deadline - now)
+                    : std::chrono::milliseconds(0)
+            );
+
+            if (!optionalResponse.has_value()) {
+                Logger::debug(
+                    "Timed out whilst waiting for TargetController to respond to " + CommandType::name + " command"
+                );
+                this->cancel();
+                throw Exceptions::Exception("Command timed out");
+            }
+
+            this->resolved = true;
+            auto& response = optionalResponse.value();
+
+            if (response->getType() == Responses::ResponseType::ERROR) {
+                const auto errorResponse = dynamic_cast<Responses::Error*>(response.get());
+
+                Logger::debug(
+                    "TargetController returned error in response to " + CommandType::name + " command (ID: "
+                        + std::to_string(this->commandId) + "). Error: " + errorResponse->errorMessage
+                );
+                throw Exceptions::Exception(errorResponse->errorMessage);
+            }
+
+            Logger::debug(
+                "Delivering response for " + CommandType::name + " command (ID: " + std::to_string(this->commandId)
+                    + ")"
+            );
+
+            // Only downcast if the command's SuccessResponseType is not the generic Response type.
+            if constexpr (!std::is_same_v<SuccessResponseType, Responses::Response>) {
+                assert(response->getType() == SuccessResponseType::type);
+                return std::unique_ptr<SuccessResponseType>(
+                    dynamic_cast<SuccessResponseType*>(response.release())
+                );
+
+            } else {
+                return std::move(response);
+            }
+        }
+
+        /**
+         * Cancels the command.
+         *
+         * If the TargetController has not yet started servicing the command, the command will be discarded. If the
+         * command is currently being serviced, it will run to completion, but its response will be discarded.
+         */
+        void cancel() {
+            if (this->resolved) {
+                return;
+            }
+
+            Logger::debug("Cancelling " + CommandType::name + " command (ID: " + std::to_string(this->commandId) + ")");
+            this->responseSlot->cancel();
+            this->resolved = true;
+        }
+
+    private:
+        Commands::CommandIdType commandId;
+        std::shared_ptr<ResponseSlot> responseSlot;
+        std::chrono::steady_clock::time_point deadline;
+
+        /**
+         * Will be true once the response has been collected, or the command has been cancelled.
+         */
+        bool resolved = false;
+    };
+}
@@ -0,0 +1,285 @@
+#include "ProgramMemoryShadow.hpp"
+
+#include <filesystem>
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
+#include "src/Helpers/Paths.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::TargetController
+{
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetMemoryAddressRange;
+
+    using Exceptions::Exception;
+
+    ProgramMemoryShadow::ProgramMemoryShadow(
+        std::string targetId,
+        std::string debugToolSerialNumber,
+        const Targets::TargetMemoryDescriptor& memoryDescriptor
+    )
+        : targetId(std::move(targetId))
+        , debugToolSerialNumber(std::move(debugToolSerialNumber))
+        , memoryDescriptor(memoryDescriptor)
+        , cache(memoryDescriptor)
+    {}
+
+    TargetMemoryBuffer ProgramMemoryShadow::fetch(
+        std::uint32_t startAddress,
+        std::uint32_t bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges,
+        const TargetMemoryCache::ReadCallback& readCallback
+    ) {
+        if (!this->verified) {
+            this->verify(readCallback);
+        }
+
+        const auto missCount = this->cache.getMissCount();
+        auto output = this->cache.fetch(startAddress, bytes, excludedAddressRanges, readCallback);
+
+        if (this->cache.getMissCount() != missCount) {
+            this->modified = true;
+        }
+
+        return output;
+    }
+
+    void ProgramMemoryShadow::update(std::uint32_t startAddress, const TargetMemoryBuffer& buffer) {
+        this->cache.update(startAddress, buffer);
+        this->modified = true;
+    }
+
+    void ProgramMemoryShadow::clear() {
+        if (this->cache.isEmpty()) {
+            return;
+        }
+
+        this->cache.clear();
+        this->verified = true;
+        this->modified = true;
+    }
+
+    void ProgramMemoryShadow::load() {
+        const auto filePath = this->getFilePath();
+
+        if (!std::filesystem::exists(filePath)) {
+            return;
+        }
+
+        try {
+            auto file = std::ifstream(filePath, std::ios::binary);
+            if (!file.is_open()) {
+                throw Exception("Failed to open file");
+            }
+
+            auto magic = std::string(ProgramMemoryShadow::FILE_MAGIC.size(), '\0');
+            file.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+
+            if (!file || magic != ProgramMemoryShadow::FILE_MAGIC) {
+                throw Exception("Invalid file header");
+            }
+
+            if (ProgramMemoryShadow::readInteger<std::uint32_t>(file) != ProgramMemoryShadow::FILE_FORMAT_VERSION) {
+                throw Exception("Unsupported file format version");
+            }
+
+            const auto startAddress = ProgramMemoryShadow::readInteger<std::uint32_t>(file);
+            const auto size = ProgramMemoryShadow::readInteger<std::uint32_t>(file);
+            const auto pageSize = ProgramMemoryShadow::readInteger<std::uint32_t>(file);
+
+            if (
+                startAddress != this->memoryDescriptor.addressRange.startAddress
+                || size != this->memoryDescriptor.size()
+                || pageSize != this->cache.getPageSize()
+            ) {
+                throw Exception("Program memory layout mismatch");
+            }
+
+            const auto imageHash = ProgramMemoryShadow::readInteger<std::uint64_t>(file);
+            const auto pageCount = ProgramMemoryShadow::readInteger<std::uint32_t>(file);
+
+            for (auto i = std::uint32_t(0); i < pageCount; i++) {
+                const auto pageIndex = ProgramMemoryShadow::readInteger<std::uint32_t>(file);
+                const auto pageBytes = ProgramMemoryShadow::readInteger<std::uint32_t>(file);
+
+                if (pageBytes > pageSize) {
+                    throw Exception("Invalid page size");
+                }
+
+                auto page = TargetMemoryBuffer(pageBytes, 0x00);
+                file.read(reinterpret_cast<char*>(page.data()), static_cast<std::streamsize>(pageBytes));
+
+                if (!file) {
+                    throw Exception("Unexpected end of file");
+                }
+
+                this->cache.insertPage(pageIndex, std::move(page));
+            }
+
+            if (this->generateImageHash() != imageHash) {
+                throw Exception("Image hash mismatch");
+            }
+
+            this->verified = this->cache.isEmpty();
+            this->modified = false;
+
+            Logger::debug(
+                "Loaded program memory shadow from " + filePath + " ("
+                    + std::to_string(this->cache.getPagesByIndex().size()) + " pages)"
+            );
+
+        } catch (const Exception& exception) {
+            Logger::warning(
+                "Discarding program memory shadow (" + filePath + ") - " + exception.getMessage()
+            );
+
+            this->cache.clear();
+            this->verified = true;
+            this->modified = true;
+        }
+    }
+
+    void ProgramMemoryShadow::save() {
+        if (!this->modified) {
+            return;
+        }
+
+        const auto filePath = this->getFilePath();
+
+        try {
+            std::filesystem::create_directories(std::filesystem::path(filePath).parent_path());
+
+            auto file = std::ofstream(filePath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                throw Exception("Failed to open/create file. Check file permissions.");
+            }
+
+            const auto& pagesByIndex = this->cache.getPagesByIndex();
+
+            file.write(
+                ProgramMemoryShadow::FILE_MAGIC.data(),
+                static_cast<std::streamsize>(ProgramMemoryShadow::FILE_MAGIC.size())
+            );
+            ProgramMemoryShadow::writeInteger(file, ProgramMemoryShadow::FILE_FORMAT_VERSION);
+            ProgramMemoryShadow::writeInteger(file, this->memoryDescriptor.addressRange.startAddress);
+            ProgramMemoryShadow::writeInteger(file, this->memoryDescriptor.size());
+            ProgramMemoryShadow::writeInteger(file, this->cache.getPageSize());
+            ProgramMemoryShadow::writeInteger(file, this->generateImageHash());
+            ProgramMemoryShadow::writeInteger(file, static_cast<std::uint32_t>(pagesByIndex.size()));
+
+            for (const auto& [pageIndex, page] : pagesByIndex) {
+                ProgramMemoryShadow::writeInteger(file, pageIndex);
+                ProgramMemoryShadow::writeInteger(file, static_cast<std::uint32_t>(page.size()));
+                file.write(reinterpret_cast<const char*>(page.data()), static_cast<std::streamsize>(page.size()));
+            }
+
+            file.close();
+
+            if (!file) {
+                throw Exception("Failed to write to file");
+            }
+
+            this->modified = false;
+            Logger::debug("Saved program memory shadow to " + filePath);
+
+        } catch (const std::exception& exception) {
+            Logger::error("Failed to save program memory shadow - " + std::string(exception.what()));
+        }
+    }
+
+    std::string ProgramMemoryShadow::getFilePath() const {
+        // Serial numbers are reported by the debug tool - we don't trust them to be safe for use in file names
+        auto serialNumber = this->debugToolSerialNumber;
+        std::replace_if(
+            serialNumber.begin(),
+            serialNumber.end(),
+            [] (char character) {
+                return !std::isalnum(static_cast<unsigned char>(character));
+            },
+            '_'
+        );
+
+        return Paths::projectSettingsDirPath() + "/ProgramMemoryShadows/" + this->targetId + "-" + serialNumber
+            + ".bin";
+    }
+
+    std::uint64_t ProgramMemoryShadow::generateImageHash() const {
+        static constexpr auto FNV_OFFSET_BASIS = std::uint64_t(0xcbf29ce484222325);
+        static constexpr auto FNV_PRIME = std::uint64_t(0x100000001b3);
+
+        auto hash = FNV_OFFSET_BASIS;
+        const auto hashByte = [&hash] (unsigned char byte) {
+            hash ^= byte;
+            hash *= FNV_PRIME;
+        };
+
+        for (const auto& [pageIndex, page] : this->cache.getPagesByIndex()) {
+            for (auto i = std::size_t(0); i < sizeof(pageIndex); i++) {
+                hashByte(static_cast<unsigned char>((pageIndex >> (i * 8)) & 0xFF));
+            }
+
+            for (const auto byte : page) {
+                hashByte(byte);
+            }
+        }
+
+        return hash;
+    }
+
+    void ProgramMemoryShadow::verify(const TargetMemoryCache::ReadCallback& readCallback) {
+        const auto& pagesByIndex = this->cache.getPagesByIndex();
+        const auto pageSize = this->cache.getPageSize();
+        const auto startAddress = this->memoryDescriptor.addressRange.startAddress;
+
+        /*
+         * We sample the first and last cached pages, along with evenly spaced pages in between, up to
+         * VERIFICATION_SAMPLE_PAGE_COUNT pages in total.
+         */
+        auto cachedPageIndices = std::vector<std::uint32_t>();
+        cachedPageIndices.reserve(pagesByIndex.size());
+
+        for (const auto& [pageIndex, page] : pagesByIndex) {
+            cachedPageIndices.push_back(pageIndex);
+        }
+
+        auto samplePageIndices = std::set<std::uint32_t>();
+
+        if (cachedPageIndices.size() <= ProgramMemoryShadow::VERIFICATION_SAMPLE_PAGE_COUNT) {
+            samplePageIndices.insert(cachedPageIndices.begin(), cachedPageIndices.end());
+
+        } else {
+            const auto lastPosition = cachedPageIndices.size() - 1;
+            const auto sampleIntervals = std::max(
+                static_cast<std::size_t>(ProgramMemoryShadow::VERIFICATION_SAMPLE_PAGE_COUNT - 1),
+                std::size_t(1)
+            );
+
+            for (auto i = std::size_t(0); i < ProgramMemoryShadow::VERIFICATION_SAMPLE_PAGE_COUNT; i++) {
+                samplePageIndices.insert(cachedPageIndices[(i * lastPosition) / sampleIntervals]);
+            }
+        }
+
+        for (const auto pageIndex : samplePageIndices) {
+            const auto& page = pagesByIndex.at(pageIndex);
+            const auto targetPage = readCallback(
+                startAddress + (pageIndex * pageSize),
+                static_cast<std::uint32_t>(page.size())
+            );
+
+            if (targetPage != page) {
+                Logger::warning(
+                    "Program memory shadow does not match the target's program memory - discarding shadow"
+                );
+
+                this->cache.clear();
+                this->modified = true;
+                break;
+            }
+        }
+
+        this->verified = true;
+    }
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <set>
+#include <fstream>
+
+#include "TargetMemoryCache.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A host-side shadow of the target's program memory, which persists between sessions.
+     *
+     * The contents of program memory only change when Bloom programs the target, so unlike the other memory caches,
+     * the shadow is not cleared when the target resumes execution. It's populated with data read from, and written
+     * to, program memory, and is stored in the project's settings directory, in a file named after the target's ID
+     * and the debug tool's serial number (the same target may be fitted to more than one board).
+     *
+     * The file holds a hash of the shadow image, which is checked upon loading. Because the target may have been
+     * programmed by some other means between sessions, we also compare a small sample of the loaded pages with the
+     * target's program memory, before serving any reads from the shadow. If the sample doesn't match, the shadow is
+     * discarded.
+     */
+    class ProgramMemoryShadow
+    {
+    public:
+        /**
+         * The maximum number of pages to read from the target, when checking a loaded shadow.
+         */
+        static constexpr std::uint32_t VERIFICATION_SAMPLE_PAGE_COUNT = 3;
+
+        ProgramMemoryShadow(
+            std::string targetId,
+            std::string debugToolSerialNumber,
+            const Targets::TargetMemoryDescriptor& memoryDescriptor
+        );
+
+        [[nodiscard]] bool contains(std::uint32_t startAddress, std::uint32_t bytes) const {
+            return this->cache.contains(startAddress, bytes);
+        }
+
+        /**
+         * Fetches program memory from the shadow, reading any missing pages from the target via the given callback.
+         *
+         * If the shadow was loaded from disk and has not yet been verified, it will be verified before servicing the
+         * read.
+         *
+         * See TargetMemoryCache::fetch() for more.
+         *
+         * @param startAddress
+         * @param bytes
+         * @param excludedAddressRanges
+         * @param readCallback
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer fetch(
+            std::uint32_t startAddress,
+            std::uint32_t bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges,
+            const TargetMemoryCache::ReadCallback& readCallback
+        );
+
+        /**
+         * Updates the shadow with data that has just been written to program memory.
+         *
+         * @param startAddress
+         * @param buffer
+         */
+        void update(std::uint32_t startAddress, const Targets::TargetMemoryBuffer& buffer);
+
+        /**
+         * Discards the entire shadow.
+         */
+        void clear();
+
+        /**
+         * Loads the shadow from disk, if a shadow file exists for the target.
+         */
+        void load();
+
+        /**
+         * Saves the shadow to disk, if it has been modified since it was last loaded or saved.
+         */
+        void save();
+
+        [[nodiscard]] std::uint64_t getHitCount() const {
+            return this->cache.getHitCount();
+        }
+
+        [[nodiscard]] std::uint64_t getMissCount() const {
+            return this->cache.getMissCount();
+        }
+
+    private:
+        static constexpr auto FILE_MAGIC = std::string_view("BLOOMPMS");
+        static constexpr std::uint32_t FILE_FORMAT_VERSION = 1;
+
+        std::string targetId;
+        std::string debugToolSerialNumber;
+        Targets::TargetMemoryDescriptor memoryDescriptor;
+        TargetMemoryCache cache;
+
+        /**
+         * Whether the shadow's contents have been confirmed to match the target's program memory.
+         */
+        bool verified = true;
+
+        /**
+         * Whether the shadow has been modified since it was last loaded or saved.
+         */
+        bool modified = false;
+
+        [[nodiscard]] std::string getFilePath() const;
+
+        /**
+         * All integers in the shadow file are stored in little-endian form, regardless of the host's byte order.
+         *
+         * @tparam IntegerType
+         * @param file
+         * @param value
+         */
+        template<typename IntegerType>
+        static void writeInteger(std::ofstream& file, IntegerType value) {
+            for (auto i = std::size_t(0); i < sizeof(IntegerType); i++) {
+                file.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+            }
+        }
+
+        template<typename IntegerType>
+        static IntegerType readInteger(std::ifstream& file) {
+            auto value = IntegerType(0);
+
+            for (auto i = std::size_t(0); i < sizeof(IntegerType); i++) {
+                const auto byte = file.get();
+
+                if (byte == std::ifstream::traits_type::eof()) {
+                    throw Exceptions::Exception("Unexpected end of file");
+                }
+
+                value |= static_cast<IntegerType>(static_cast<IntegerType>(byte & 0xFF) << (i * 8));
+            }
+
+            return value;
+        }
+
+        /**
+         * Generates a hash (FNV-1a) of the shadow image - the cached pages along with their indices.
+         *
+         * @return
+         */
+        [[nodiscard]] std::uint64_t generateImageHash() const;
+
+        /**
+         * Compares a sample of the cached pages (no more than VERIFICATION_SAMPLE_PAGE_COUNT) with the target's
+         * program memory. The shadow is discarded if any of the sampled pages differ.
+         *
+         * @param readCallback
+         */
+        void verify(const TargetMemoryCache::ReadCallback& readCallback);
+    };
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <optional>
+#include <functional>
+
+#include "Responses/Response.hpp"
+
+#include "src/Helpers/PoolAllocator.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A ResponseSlot is where the TargetController delivers the response to a single command.
+     *
+     * Each command issued to the TargetController is paired with its own slot (see
+     * TargetControllerComponent::registerCommand()). Delivering a response to a slot only wakes the thread waiting
+     * on that slot.
+     *
+     * Slots are shared between the issuer and the TargetController, so the slot remains valid for the TargetController
+     * even if the issuer abandons the command. Slots should be constructed via ResponseSlot::create(), which allocates
+     * them from a pool.
+     */
+    class ResponseSlot
+    {
+    public:
+        ResponseSlot() = default;
+
+        ResponseSlot(const ResponseSlot& other) = delete;
+        ResponseSlot& operator = (const ResponseSlot& other) = delete;
+
+        ResponseSlot(ResponseSlot&& other) = delete;
+        ResponseSlot& operator = (ResponseSlot&& other) = delete;
+
+        static std::shared_ptr<ResponseSlot> create() {
+            return std::allocate_shared<ResponseSlot>(PoolAllocator<ResponseSlot>());
+        }
+
+        /**
+         * Records the response and wakes the waiting thread (if any).
+         *
+         * Responses delivered to cancelled slots are discarded.
+         *
+         * @param response
+         */
+        void setResponse(std::unique_ptr<Responses::Response> response) {
+            {
+                auto lock = std::unique_lock(this->mutex);
+
+                if (this->cancelled) {
+                    return;
+                }
+
+                this->response = std::move(response);
+
+                if (this->completionCallback) {
+                    this->completionCallback();
+                }
+            }
+
+            this->conditionVariable.notify_one();
+        }
+
+        /**
+         * Sets a callback to be invoked once a response has been delivered to this slot. If a response has already
+         * been delivered, the callback is invoked immediately.
+         *
+         * The callback is invoked with the slot's mutex held, usually from the TargetController's thread. It must be
+         * brief and must not access the slot. Recording a notification (for the issuer to act upon) is about all it
+         * should do. The callback will not be invoked after the slot has been cancelled.
+         *
+         * @param callback
+         */
+        void setCompletionCallback(std::function<void(void)> callback) {
+            auto lock = std::unique_lock(this->mutex);
+
+            if (this->cancelled) {
+                return;
+            }
+
+            this->completionCallback = std::move(callback);
+
+            if (this->response != nullptr && this->completionCallback) {
+                this->completionCallback();
+            }
+        }
+
+        /**
+         * Checks if a response has been delivered to this slot, without blocking.
+         *
+         * @return
+         */
+        bool isResponseAvailable() {
+            auto lock = std::unique_lock(this->mutex);
+            return this->response != nullptr;
+        }
+
+        /**
+         * Waits for the response to be delivered, and takes ownership of it.
+         *
+         * @param timeout
+         *
+         * @return
+         *  The response, or std::nullopt if the timeout was reached.
+         */
+        std::optional<std::unique_ptr<Responses::Response>> waitForResponse(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        ) {
+            const auto predicate = [this] {
+                return this->response != nullptr;
+            };
+
+            auto lock = std::unique_lock(this->mutex);
+
+            if (timeout.has_value()) {
+                this->conditionVariable.wait_for(lock, timeout.value(), predicate);
+
+            } else {
+                this->conditionVariable.wait(lock, predicate);
+            }
+
+            return (this->response != nullptr) ? std::optional(std::move(this->response)) : std::nullopt;
+        }
+
+        /**
+         * Marks the slot as cancelled. Any response already delivered will be discarded, as will any subsequent
+         * responses. The TargetController will not service commands with cancelled slots.
+         */
+        void cancel() {
+            auto lock = std::unique_lock(this->mutex);
+            this->cancelled = true;
+            this->response.reset();
+            this->completionCallback = nullptr;
+        }
+
+        bool isCancelled() {
+            auto lock = std::unique_lock(this->mutex);
+            return this->cancelled;
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable conditionVariable;
+        std::unique_ptr<Responses::Response> response = nullptr;
+        std::function<void(void)> completionCallback;
+        bool cancelled = false;
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "Response.hpp"
+
+namespace Bloom::TargetController::Responses
+{
+    /**
+     * Response to the CommandBatch command. Holds a response for each command in the batch, in the order in which
+     * the commands were issued.
+     *
+     * Failed commands will be paired with an Error response.
+     */
+    class CommandBatchResponses: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::COMMAND_BATCH_RESPONSES;
+
+        std::vector<std::unique_ptr<Response>> responses;
+
+        explicit CommandBatchResponses(std::vector<std::unique_ptr<Response>>&& responses)
+            : responses(std::move(responses))
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return CommandBatchResponses::type;
+        }
+    };
+}
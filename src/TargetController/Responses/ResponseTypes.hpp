@@ -15,5 +15,6 @@ namespace Bloom::TargetController::Responses
         TARGET_PIN_STATES,
         TARGET_STACK_POINTER,
         TARGET_PROGRAM_COUNTER,
+        COMMAND_BATCH_RESPONSES,
     };
 }
@@ -4,6 +4,7 @@
 #include <filesystem>
 #include <typeindex>
 #include <algorithm>
+#include <iterator>
 
 #include "src/Application.hpp"
 #include "src/Helpers/Paths.hpp"
@@ -42,6 +43,7 @@ namespace Bloom::TargetController
     using Commands::GetTargetProgramCounter;
     using Commands::EnableProgrammingMode;
     using Commands::DisableProgrammingMode;
+    using Commands::CommandBatch;
 
     using Responses::Response;
     using Responses::TargetRegistersRead;
@@ -49,6 +51,7 @@ namespace Bloom::TargetController
     using Responses::TargetPinStates;
     using Responses::TargetStackPointer;
     using Responses::TargetProgramCounter;
+    using Responses::CommandBatchResponses;
 
     TargetControllerComponent::TargetControllerComponent(
         const ProjectConfig& projectConfig,
@@ -71,7 +74,7 @@ namespace Bloom::TargetController
                         this->fireTargetEvents();
                     }
 
-                    TargetControllerComponent::notifier.waitForNotification(std::chrono::milliseconds(60));
+                    TargetControllerComponent::notifier.waitForNotification(this->getNotificationWaitTimeout());
 
                     this->processQueuedCommands();
                     this->eventListener->dispatchCurrentEvents();
@@ -113,46 +116,19 @@ namespace Bloom::TargetController
         return TargetControllerComponent::state;
     }
 
-    void TargetControllerComponent::registerCommand(std::unique_ptr<Command> command) {
-        auto commandQueueLock = TargetControllerComponent::commandQueue.acquireLock();
-        TargetControllerComponent::commandQueue.getValue().push(std::move(command));
-        TargetControllerComponent::notifier.notify();
-    }
-
-    std::optional<std::unique_ptr<Responses::Response>> TargetControllerComponent::waitForResponse(
-        CommandIdType commandId,
-        std::optional<std::chrono::milliseconds> timeout
-    ) {
-        auto response = std::unique_ptr<Response>(nullptr);
-
-        const auto predicate = [commandId, &response] {
-            auto& responsesByCommandId = TargetControllerComponent::responsesByCommandId.getValue();
-            auto responseIt = responsesByCommandId.find(commandId);
-
-            if (responseIt != responsesByCommandId.end()) {
-                response.swap(responseIt->second);
-                responsesByCommandId.erase(responseIt);
+    std::shared_ptr<ResponseSlot> TargetControllerComponent::registerCommand(std::unique_ptr<Command> command) {
+        auto responseSlot = ResponseSlot::create();
 
-                return true;
-            }
-
-            return false;
-        };
-
-        auto responsesByCommandIdLock = TargetControllerComponent::responsesByCommandId.acquireLock();
-
-        if (timeout.has_value()) {
-            TargetControllerComponent::responsesByCommandIdCv.wait_for(
-                responsesByCommandIdLock,
-                timeout.value(),
-                predicate
+        {
+            auto commandQueueLock = TargetControllerComponent::commandQueuesByPriority.acquireLock();
+            const auto priority = command->priority;
+            TargetControllerComponent::commandQueuesByPriority.getValue()[priority].push(
+                QueuedCommand{std::move(command), responseSlot}
             );
-
-        } else {
-            TargetControllerComponent::responsesByCommandIdCv.wait(responsesByCommandIdLock, predicate);
         }
 
-        return (response != nullptr) ? std::optional(std::move(response)) : std::nullopt;
+        TargetControllerComponent::notifier.notify();
+        return responseSlot;
     }
 
     void TargetControllerComponent::deregisterCommandHandler(Commands::CommandType commandType) {
@@ -190,14 +166,16 @@ namespace Bloom::TargetController
         return std::map<std::string, std::function<std::unique_ptr<DebugTool>()>> {
             {
                 "atmel-ice",
-                [] {
-                    return std::make_unique<DebugToolDrivers::AtmelIce>();
+                [this] {
+                    return std::make_unique<DebugToolDrivers::AtmelIce>(this->environmentConfig.debugToolConfig);
                 }
             },
             {
                 "power-debugger",
-                [] {
-                    return std::make_unique<DebugToolDrivers::PowerDebugger>();
+                [this] {
+                    return std::make_unique<DebugToolDrivers::PowerDebugger>(
+                        this->environmentConfig.debugToolConfig
+                    );
                 }
             },
             {
@@ -242,6 +220,12 @@ namespace Bloom::TargetController
                     return std::make_unique<DebugToolDrivers::JtagIce3>();
                 }
             },
+            {
+                "simulator",
+                [this] {
+                    return std::make_unique<DebugToolDrivers::Simulator>(this->environmentConfig.debugToolConfig);
+                }
+            },
         };
     }
 
@@ -289,59 +273,69 @@ namespace Bloom::TargetController
         return mapping;
     }
 
-    void TargetControllerComponent::processQueuedCommands() {
-        auto commands = std::queue<std::unique_ptr<Command>>();
-
-        {
-            auto queueLock = TargetControllerComponent::commandQueue.acquireLock();
-            commands.swap(TargetControllerComponent::commandQueue.getValue());
-        }
+    void TargetControllerComponent::processQueuedCommands(std::optional<Commands::CommandPriority> higherThan) {
+        auto queuedCommand = std::optional<QueuedCommand>();
 
-        while (!commands.empty()) {
-            const auto command = std::move(commands.front());
-            commands.pop();
+        while ((queuedCommand = TargetControllerComponent::popNextQueuedCommand(higherThan)).has_value()) {
+            auto& command = queuedCommand->command;
+            auto& responseSlot = queuedCommand->responseSlot;
 
-            const auto commandId = command->id;
-            const auto commandType = command->getType();
+            if (responseSlot->isCancelled()) {
+                Logger::debug("Discarding cancelled command (ID: " + std::to_string(command->id) + ")");
+                continue;
+            }
 
             try {
-                if (!this->commandHandlersByCommandType.contains(commandType)) {
-                    throw Exception("No handler registered for this command.");
-                }
+                responseSlot->setResponse(this->processCommand(*(command.get())));
 
-                if (command->requiresStoppedTargetState() && this->lastTargetState != TargetState::STOPPED) {
-                    throw Exception("Illegal target state - command requires target to be stopped");
-                }
+            } catch (const Exception& exception) {
+                responseSlot->setResponse(std::make_unique<Responses::Error>(exception.getMessage()));
+            }
+        }
+    }
 
-                if (this->target->programmingModeEnabled() && command->requiresDebugMode()) {
-                    throw Exception(
-                        "Illegal target state - command cannot be serviced whilst the target is in programming mode."
-                    );
-                }
+    std::optional<TargetControllerComponent::QueuedCommand> TargetControllerComponent::popNextQueuedCommand(
+        std::optional<Commands::CommandPriority> higherThan
+    ) {
+        auto queueLock = TargetControllerComponent::commandQueuesByPriority.acquireLock();
+        auto& commandQueuesByPriority = TargetControllerComponent::commandQueuesByPriority.getValue();
 
-                this->registerCommandResponse(
-                    commandId,
-                    this->commandHandlersByCommandType.at(commandType)(*(command.get()))
-                );
+        // Iterate in reverse, to start with the highest priority
+        for (auto queueIt = commandQueuesByPriority.rbegin(); queueIt != commandQueuesByPriority.rend(); ++queueIt) {
+            auto& [priority, commands] = *queueIt;
 
-            } catch (const Exception& exception) {
-                this->registerCommandResponse(
-                    commandId,
-                    std::make_unique<Responses::Error>(exception.getMessage())
-                );
+            if (higherThan.has_value() && priority <= higherThan.value()) {
+                break;
+            }
+
+            if (!commands.empty()) {
+                auto queuedCommand = std::move(commands.front());
+                commands.pop();
+                return queuedCommand;
             }
         }
+
+        return std::nullopt;
     }
 
-    void TargetControllerComponent::registerCommandResponse(
-        CommandIdType commandId,
-        std::unique_ptr<Response> response
-    ) {
-        auto responseMappingLock = TargetControllerComponent::responsesByCommandId.acquireLock();
-        TargetControllerComponent::responsesByCommandId.getValue().insert(
-            std::pair(commandId, std::move(response))
-        );
-        TargetControllerComponent::responsesByCommandIdCv.notify_all();
+    std::unique_ptr<Response> TargetControllerComponent::processCommand(Command& command) {
+        const auto commandType = command.getType();
+
+        if (!this->commandHandlersByCommandType.contains(commandType)) {
+            throw Exception("No handler registered for this command.");
+        }
+
+        if (command.requiresStoppedTargetState() && this->lastTargetState != TargetState::STOPPED) {
+            throw Exception("Illegal target state - command requires target to be stopped");
+        }
+
+        if (this->target->programmingModeEnabled() && command.requiresDebugMode()) {
+            throw Exception(
+                "Illegal target state - command cannot be serviced whilst the target is in programming mode."
+            );
+        }
+
+        return this->commandHandlersByCommandType.at(commandType)(command);
     }
 
     void TargetControllerComponent::checkUdevRules() {
@@ -430,13 +424,17 @@ namespace Bloom::TargetController
         this->deregisterCommandHandler(GetTargetProgramCounter::type);
         this->deregisterCommandHandler(EnableProgrammingMode::type);
         this->deregisterCommandHandler(DisableProgrammingMode::type);
+        this->deregisterCommandHandler(CommandBatch::type);
 
         this->eventListener->deregisterCallbacksForEventType<Events::DebugSessionFinished>();
 
         this->lastTargetState = TargetState::UNKNOWN;
+        this->targetStateChangeNotificationsEnabled = false;
         this->cachedTargetDescriptor = std::nullopt;
         this->registerDescriptorsByMemoryType.clear();
         this->registerAddressRangeByMemoryType.clear();
+        this->clearMemoryCaches();
+        this->memoryCachesByType.clear();
 
         TargetControllerComponent::state = TargetControllerState::SUSPENDED;
         EventManager::triggerEvent(std::make_shared<TargetControllerStateChanged>(TargetControllerComponent::state));
@@ -447,6 +445,8 @@ namespace Bloom::TargetController
     void TargetControllerComponent::resume() {
         this->acquireHardware();
         this->loadRegisterDescriptors();
+        this->loadMemoryCaches();
+        this->loadProgramMemoryShadow();
 
         this->registerCommandHandler<GetTargetDescriptor>(
             std::bind(&TargetControllerComponent::handleGetTargetDescriptor, this, std::placeholders::_1)
@@ -524,6 +524,10 @@ namespace Bloom::TargetController
             std::bind(&TargetControllerComponent::handleDisableProgrammingMode, this, std::placeholders::_1)
         );
 
+        this->registerCommandHandler<CommandBatch>(
+            std::bind(&TargetControllerComponent::handleCommandBatch, this, std::placeholders::_1)
+        );
+
         this->eventListener->registerCallbackForEventType<Events::DebugSessionFinished>(
             std::bind(&TargetControllerComponent::onDebugSessionFinishedEvent, this, std::placeholders::_1)
         );
@@ -534,6 +538,7 @@ namespace Bloom::TargetController
         );
 
         if (this->target->getState() != TargetState::RUNNING) {
+            this->commitBreakpoints();
             this->target->run();
             this->lastTargetState = TargetState::RUNNING;
         }
@@ -600,6 +605,14 @@ namespace Bloom::TargetController
 
         Logger::info("Target ID: " + this->target->getHumanReadableId());
         Logger::info("Target name: " + this->target->getName());
+
+        this->targetStateChangeNotificationsEnabled = this->target->setStateChangeNotifier(
+            &TargetControllerComponent::notifier
+        );
+
+        if (!this->targetStateChangeNotificationsEnabled) {
+            Logger::debug("Target cannot report state changes - falling back to polling whilst the target is running");
+        }
     }
 
     void TargetControllerComponent::releaseHardware() {
@@ -610,6 +623,15 @@ namespace Bloom::TargetController
         auto debugTool = std::move(this->debugTool);
         auto target = std::move(this->target);
 
+        // Target deactivation clears all breakpoints
+        this->requestedBreakpointAddresses.clear();
+        this->committedBreakpointAddresses.clear();
+
+        if (this->programMemoryShadow.has_value()) {
+            this->programMemoryShadow->save();
+            this->programMemoryShadow = std::nullopt;
+        }
+
         if (debugTool != nullptr && debugTool->isInitialised()) {
             if (target != nullptr) {
                 /*
@@ -697,11 +719,92 @@ namespace Bloom::TargetController
         return output;
     }
 
+    void TargetControllerComponent::loadMemoryCaches() {
+        for (const auto& [memoryType, memoryDescriptor] : this->getTargetDescriptor().memoryDescriptorsByType) {
+            this->memoryCachesByType.insert(std::pair(memoryType, TargetMemoryCache(memoryDescriptor)));
+        }
+    }
+
+    void TargetControllerComponent::loadProgramMemoryShadow() {
+        const auto& targetDescriptor = this->getTargetDescriptor();
+        const auto memoryDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(
+            targetDescriptor.programMemoryType
+        );
+
+        if (memoryDescriptorIt == targetDescriptor.memoryDescriptorsByType.end()) {
+            return;
+        }
+
+        this->programMemoryShadow = ProgramMemoryShadow(
+            targetDescriptor.id,
+            this->debugTool->getSerialNumber(),
+            memoryDescriptorIt->second
+        );
+        this->programMemoryShadow->load();
+    }
+
+    void TargetControllerComponent::clearMemoryCaches() {
+        auto cachesWereEmpty = true;
+        auto hitCount = std::uint64_t(0);
+        auto missCount = std::uint64_t(0);
+
+        for (auto& [memoryType, memoryCache] : this->memoryCachesByType) {
+            cachesWereEmpty = cachesWereEmpty && memoryCache.isEmpty();
+            hitCount += memoryCache.getHitCount();
+            missCount += memoryCache.getMissCount();
+
+            memoryCache.clear();
+        }
+
+        if (!cachesWereEmpty) {
+            Logger::debug(
+                "Target memory caches cleared - total page hits: " + std::to_string(hitCount)
+                    + ", total page misses: " + std::to_string(missCount)
+            );
+        }
+    }
+
+    TargetMemoryBuffer TargetControllerComponent::readTargetMemory(
+        TargetMemoryType memoryType,
+        std::uint32_t startAddress,
+        std::uint32_t bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        const auto readCallback = [this, memoryType, &excludedAddressRanges] (
+            std::uint32_t readStartAddress,
+            std::uint32_t readBytes
+        ) {
+            return this->target->readMemory(memoryType, readStartAddress, readBytes, excludedAddressRanges);
+        };
+
+        if (
+            this->programMemoryShadow.has_value()
+            && memoryType == this->getTargetDescriptor().programMemoryType
+            && this->programMemoryShadow->contains(startAddress, bytes)
+        ) {
+            return this->programMemoryShadow->fetch(startAddress, bytes, excludedAddressRanges, readCallback);
+        }
+
+        auto memoryCacheIt = this->memoryCachesByType.find(memoryType);
+
+        if (
+            memoryCacheIt == this->memoryCachesByType.end()
+            || this->lastTargetState != TargetState::STOPPED
+            || this->target->programmingModeEnabled()
+            || !memoryCacheIt->second.contains(startAddress, bytes)
+        ) {
+            return this->target->readMemory(memoryType, startAddress, bytes, excludedAddressRanges);
+        }
+
+        return memoryCacheIt->second.fetch(startAddress, bytes, excludedAddressRanges, readCallback);
+    }
+
     void TargetControllerComponent::fireTargetEvents() {
         auto newTargetState = this->target->getState();
 
         if (newTargetState != this->lastTargetState) {
             this->lastTargetState = newTargetState;
+            this->clearMemoryCaches();
 
             if (newTargetState == TargetState::STOPPED) {
                 Logger::debug("Target state changed - STOPPED");
@@ -718,15 +821,88 @@ namespace Bloom::TargetController
         }
     }
 
+    std::optional<std::chrono::milliseconds> TargetControllerComponent::getNotificationWaitTimeout() const {
+        if (
+            TargetControllerComponent::state == TargetControllerState::ACTIVE
+            && this->lastTargetState != TargetState::STOPPED
+            && !this->targetStateChangeNotificationsEnabled
+        ) {
+            return TargetControllerComponent::TARGET_STATE_POLL_INTERVAL;
+        }
+
+        return std::nullopt;
+    }
+
     void TargetControllerComponent::resetTarget() {
         this->target->reset();
+        this->clearMemoryCaches();
 
         EventManager::triggerEvent(std::make_shared<Events::TargetReset>());
     }
 
+    void TargetControllerComponent::commitBreakpoints() {
+        auto addressesToRemove = std::set<std::uint32_t>();
+        std::set_difference(
+            this->committedBreakpointAddresses.begin(),
+            this->committedBreakpointAddresses.end(),
+            this->requestedBreakpointAddresses.begin(),
+            this->requestedBreakpointAddresses.end(),
+            std::inserter(addressesToRemove, addressesToRemove.end())
+        );
+
+        auto addressesToSet = std::set<std::uint32_t>();
+        std::set_difference(
+            this->requestedBreakpointAddresses.begin(),
+            this->requestedBreakpointAddresses.end(),
+            this->committedBreakpointAddresses.begin(),
+            this->committedBreakpointAddresses.end(),
+            std::inserter(addressesToSet, addressesToSet.end())
+        );
+
+        if (!addressesToRemove.empty()) {
+            try {
+                this->target->removeBreakpoints(addressesToRemove);
+
+            } catch (const Exception& exception) {
+                throw Exception("Failed to remove deferred breakpoints - " + exception.getMessage());
+            }
+
+            for (const auto address : addressesToRemove) {
+                this->committedBreakpointAddresses.erase(address);
+            }
+        }
+
+        if (!addressesToSet.empty()) {
+            try {
+                this->target->setBreakpoints(addressesToSet);
+
+            } catch (const Exception& exception) {
+                throw Exception("Failed to set deferred breakpoints - " + exception.getMessage());
+            }
+
+            this->committedBreakpointAddresses.insert(addressesToSet.begin(), addressesToSet.end());
+        }
+    }
+
     void TargetControllerComponent::enableProgrammingMode() {
         Logger::debug("Enabling programming mode");
+
+        /*
+         * Any breakpoints that were removed by the client must be removed from the target before it's programmed,
+         * otherwise the debug tool may later restore the instructions it replaced, over the newly programmed ones.
+         */
+        this->commitBreakpoints();
+
         this->target->enableProgrammingMode();
+        this->clearMemoryCaches();
+
+        if (this->programMemoryShadow.has_value()) {
+            /*
+             * Targets may erase some or all of their program memory before programming, so we can no longer trust
+             * the shadow. It will be repopulated with whatever is written to, and read from, program memory.
+             */
+            this->programMemoryShadow->clear();
+        }
         Logger::warning("Programming mode enabled");
 
         EventManager::triggerEvent(std::make_shared<Events::ProgrammingModeEnabled>());
@@ -735,6 +911,11 @@ namespace Bloom::TargetController
     void TargetControllerComponent::disableProgrammingMode() {
         Logger::debug("Disabling programming mode");
         this->target->disableProgrammingMode();
+        this->clearMemoryCaches();
+
+        if (this->programMemoryShadow.has_value()) {
+            this->programMemoryShadow->save();
+        }
         Logger::info("Programming mode disabled");
 
         EventManager::triggerEvent(std::make_shared<Events::ProgrammingModeDisabled>());
@@ -763,6 +944,7 @@ namespace Bloom::TargetController
 
     void TargetControllerComponent::onDebugSessionFinishedEvent(const DebugSessionFinished&) {
         if (this->target->getState() != TargetState::RUNNING) {
+            this->commitBreakpoints();
             this->target->run();
             this->fireTargetEvents();
         }
@@ -804,8 +986,10 @@ namespace Bloom::TargetController
                 this->target->setProgramCounter(command.fromProgramCounter.value());
             }
 
+            this->commitBreakpoints();
             this->target->run();
             this->lastTargetState = TargetState::RUNNING;
+            this->clearMemoryCaches();
         }
 
         EventManager::triggerEvent(std::make_shared<Events::TargetExecutionResumed>());
@@ -827,6 +1011,19 @@ namespace Bloom::TargetController
     std::unique_ptr<Response> TargetControllerComponent::handleWriteTargetRegisters(WriteTargetRegisters& command) {
         this->target->writeRegisters(command.registers);
 
+        /*
+         * Registers that are mapped to memory may reside in one of our memory caches. The encoding of register values
+         * in memory is target specific, so we just drop the affected pages, instead of updating them.
+         */
+        for (const auto& targetRegister : command.registers) {
+            const auto& registerDescriptor = targetRegister.descriptor;
+            auto memoryCacheIt = this->memoryCachesByType.find(registerDescriptor.memoryType);
+
+            if (memoryCacheIt != this->memoryCachesByType.end() && registerDescriptor.startAddress.has_value()) {
+                memoryCacheIt->second.invalidate(registerDescriptor.startAddress.value(), registerDescriptor.size);
+            }
+        }
+
         auto registersWrittenEvent = std::make_shared<Events::RegistersWrittenToTarget>();
         registersWrittenEvent->registers = command.registers;
 
@@ -836,12 +1033,68 @@ namespace Bloom::TargetController
     }
 
     std::unique_ptr<TargetMemoryRead> TargetControllerComponent::handleReadTargetMemory(ReadTargetMemory& command) {
-        return std::make_unique<TargetMemoryRead>(this->target->readMemory(
-            command.memoryType,
-            command.startAddress,
-            command.bytes,
-            command.excludedAddressRanges
-        ));
+        if (
+            command.priority == Commands::CommandPriority::INTERACTIVE_DEBUG
+            || command.bytes <= TargetControllerComponent::MEMORY_READ_SLICE_SIZE
+        ) {
+            return std::make_unique<TargetMemoryRead>(this->readTargetMemory(
+                command.memoryType,
+                command.startAddress,
+                command.bytes,
+                command.excludedAddressRanges
+            ));
+        }
+
+        /*
+         * Large reads of lower priority are split into slices, so that we can service any higher priority commands
+         * (such as a step or resume from GDB) in between. The slice size is kept to a multiple of the memory's
+         * page size (where applicable), to avoid reading the same page more than once.
+         */
+        auto sliceSize = TargetControllerComponent::MEMORY_READ_SLICE_SIZE;
+
+        const auto& memoryDescriptorsByType = this->getTargetDescriptor().memoryDescriptorsByType;
+        const auto memoryDescriptorIt = memoryDescriptorsByType.find(command.memoryType);
+
+        if (memoryDescriptorIt != memoryDescriptorsByType.end() && memoryDescriptorIt->second.pageSize.has_value()) {
+            const auto pageSize = memoryDescriptorIt->second.pageSize.value();
+
+            if (pageSize > 0 && sliceSize % pageSize != 0) {
+                sliceSize = ((sliceSize / pageSize) + 1) * pageSize;
+            }
+        }
+
+        auto data = TargetMemoryBuffer();
+        data.reserve(command.bytes);
+
+        while (data.size() < command.bytes) {
+            if (!data.empty()) {
+                this->processQueuedCommands(command.priority);
+
+                /*
+                 * The commands we've just processed may have changed the state of the target, in which case, we can
+                 * no longer continue with the read.
+                 */
+                if (this->lastTargetState != TargetState::STOPPED) {
+                    throw Exception("Target state changed whilst servicing memory read - target is no longer stopped");
+                }
+
+                if (this->target->programmingModeEnabled() && command.requiresDebugMode()) {
+                    throw Exception("Target state changed whilst servicing memory read - programming mode enabled");
+                }
+            }
+
+            const auto bytesRemaining = static_cast<std::uint32_t>(command.bytes - data.size());
+            const auto sliceData = this->readTargetMemory(
+                command.memoryType,
+                static_cast<std::uint32_t>(command.startAddress + data.size()),
+                std::min(sliceSize, bytesRemaining),
+                command.excludedAddressRanges
+            );
+
+            data.insert(data.end(), sliceData.begin(), sliceData.end());
+        }
+
+        return std::make_unique<TargetMemoryRead>(data);
     }
 
     std::unique_ptr<Response> TargetControllerComponent::handleWriteTargetMemory(WriteTargetMemory& command) {
@@ -856,6 +1109,16 @@ namespace Bloom::TargetController
         }
 
         this->target->writeMemory(command.memoryType, bufferStartAddress, buffer);
+
+        auto memoryCacheIt = this->memoryCachesByType.find(command.memoryType);
+        if (memoryCacheIt != this->memoryCachesByType.end()) {
+            memoryCacheIt->second.update(bufferStartAddress, buffer);
+        }
+
+        if (this->programMemoryShadow.has_value() && command.memoryType == targetDescriptor.programMemoryType) {
+            this->programMemoryShadow->update(bufferStartAddress, buffer);
+        }
+
         EventManager::triggerEvent(
             std::make_shared<Events::MemoryWrittenToTarget>(command.memoryType, bufferStartAddress, bufferSize)
         );
@@ -907,20 +1170,40 @@ namespace Bloom::TargetController
             this->target->setProgramCounter(command.fromProgramCounter.value());
         }
 
+        this->commitBreakpoints();
         this->target->step();
         this->lastTargetState = TargetState::RUNNING;
+        this->clearMemoryCaches();
         EventManager::triggerEvent(std::make_shared<Events::TargetExecutionResumed>());
 
         return std::make_unique<Response>();
     }
 
     std::unique_ptr<Response> TargetControllerComponent::handleSetBreakpoint(SetBreakpoint& command) {
-        this->target->setBreakpoint(command.breakpoint.address);
+        const auto address = command.breakpoint.address;
+
+        if (!this->committedBreakpointAddresses.contains(address)) {
+            /*
+             * Only removals are deferred - a new breakpoint is set immediately, so that any failure is reported
+             * against the command that requested it. Reinstating a breakpoint that is still committed (which is what
+             * GDB does before every resume) costs nothing.
+             */
+            this->target->setBreakpoints({address});
+            this->committedBreakpointAddresses.insert(address);
+        }
+
+        this->requestedBreakpointAddresses.insert(address);
+
         return std::make_unique<Response>();
     }
 
     std::unique_ptr<Response> TargetControllerComponent::handleRemoveBreakpoint(RemoveBreakpoint& command) {
-        this->target->removeBreakpoint(command.breakpoint.address);
+        this->requestedBreakpointAddresses.erase(command.breakpoint.address);
+
+        if (this->lastTargetState == TargetState::RUNNING) {
+            this->commitBreakpoints();
+        }
+
         return std::make_unique<Response>();
     }
 
@@ -965,4 +1248,22 @@ namespace Bloom::TargetController
 
         return std::make_unique<Response>();
     }
+
+    std::unique_ptr<CommandBatchResponses> TargetControllerComponent::handleCommandBatch(CommandBatch& command) {
+        auto responses = std::vector<std::unique_ptr<Response>>();
+        responses.reserve(command.commands.size());
+
+        for (auto& batchedCommand : command.commands) {
+            batchedCommand->priority = command.priority;
+
+            try {
+                responses.emplace_back(this->processCommand(*(batchedCommand.get())));
+
+            } catch (const Exception& exception) {
+                responses.emplace_back(std::make_unique<Responses::Error>(exception.getMessage()));
+            }
+        }
+
+        return std::make_unique<CommandBatchResponses>(std::move(responses));
+    }
 }
@@ -3,10 +3,10 @@
 #include <atomic>
 #include <memory>
 #include <queue>
-#include <condition_variable>
 #include <optional>
 #include <chrono>
 #include <map>
+#include <set>
 #include <string>
 #include <functional>
 #include <QJsonObject>
@@ -17,6 +17,9 @@
 #include "src/Helpers/ConditionVariableNotifier.hpp"
 
 #include "TargetControllerState.hpp"
+#include "ResponseSlot.hpp"
+#include "TargetMemoryCache.hpp"
+#include "ProgramMemoryShadow.hpp"
 
 // Commands
 #include "Commands/Command.hpp"
@@ -39,6 +42,7 @@
 #include "Commands/GetTargetProgramCounter.hpp"
 #include "Commands/EnableProgrammingMode.hpp"
 #include "Commands/DisableProgrammingMode.hpp"
+#include "Commands/CommandBatch.hpp"
 
 // Responses
 #include "Responses/Response.hpp"
@@ -49,6 +53,7 @@
 #include "Responses/TargetPinStates.hpp"
 #include "Responses/TargetStackPointer.hpp"
 #include "Responses/TargetProgramCounter.hpp"
+#include "Responses/CommandBatchResponses.hpp"
 
 #include "src/DebugToolDrivers/DebugTools.hpp"
 #include "src/Targets/Target.hpp"
@@ -88,24 +93,33 @@ namespace Bloom::TargetController
 
         static TargetControllerState getState();
 
-        static void registerCommand(std::unique_ptr<Commands::Command> command);
-
-        static std::optional<std::unique_ptr<Responses::Response>> waitForResponse(
-            Commands::CommandIdType commandId,
-            std::optional<std::chrono::milliseconds> timeout = std::nullopt
-        );
+        /**
+         * Queues a command for the TargetController to service.
+         *
+         * @param command
+         *
+         * @return
+         *  The slot to which the TargetController will deliver the response to the command. Cancelling the slot
+         *  cancels the command. See the ResponseSlot class for more.
+         */
+        static std::shared_ptr<ResponseSlot> registerCommand(std::unique_ptr<Commands::Command> command);
 
     private:
-        static inline SyncSafe<
-            std::queue<std::unique_ptr<Commands::Command>>
-        > commandQueue;
+        /**
+         * A command awaiting processing, paired with the slot to which its response will be delivered.
+         */
+        struct QueuedCommand
+        {
+            std::unique_ptr<Commands::Command> command;
+            std::shared_ptr<ResponseSlot> responseSlot;
+        };
 
-        static inline SyncSafe<
-            std::map<Commands::CommandIdType, std::unique_ptr<Responses::Response>>
-        > responsesByCommandId;
+        /**
+         * Queued commands, mapped by priority. Higher priority commands are serviced first.
+         */
+        static inline SyncSafe<std::map<Commands::CommandPriority, std::queue<QueuedCommand>>> commandQueuesByPriority;
 
         static inline ConditionVariableNotifier notifier = ConditionVariableNotifier();
-        static inline std::condition_variable responsesByCommandIdCv = std::condition_variable();
 
         /**
          * The TC starts off in a suspended state. TargetControllerComponent::resume() is invoked from the startup
@@ -138,6 +152,32 @@ namespace Bloom::TargetController
          */
         Targets::TargetState lastTargetState = Targets::TargetState::UNKNOWN;
 
+        /**
+         * Whether the target will notify us (via TargetControllerComponent::notifier) of any execution state changes.
+         *
+         * If this is false, we have to poll the target for state changes, whilst it's running. See
+         * TargetControllerComponent::getNotificationWaitTimeout() for more.
+         */
+        bool targetStateChangeNotificationsEnabled = false;
+
+        /**
+         * The breakpoints requested via the SetBreakpoint and RemoveBreakpoint commands, and those that are actually
+         * set on the target.
+         *
+         * GDB removes and reinserts every breakpoint around each resume and step, and on some targets (debugWire AVR
+         * targets, for example) every breakpoint change can mean a flash page rewrite. So we defer breakpoint removals
+         * until the target is about to execute (or be programmed), and then commit only the difference. See
+         * TargetControllerComponent::commitBreakpoints().
+         */
+        std::set<std::uint32_t> requestedBreakpointAddresses;
+        std::set<std::uint32_t> committedBreakpointAddresses;
+
+        /**
+         * How often we poll the target for state changes, when the target is running and it cannot notify us of such
+         * changes.
+         */
+        static constexpr auto TARGET_STATE_POLL_INTERVAL = std::chrono::milliseconds(60);
+
         /**
          * Obtaining a TargetDescriptor for the connected target can be quite expensive. We cache it here.
          */
@@ -153,6 +193,21 @@ namespace Bloom::TargetController
          */
         std::map<Targets::TargetMemoryType, Targets::TargetMemoryAddressRange> registerAddressRangeByMemoryType;
 
+        /**
+         * Caches of target memory, mapped by memory type. Used to service repeated memory reads whilst the target is
+         * stopped.
+         *
+         * All caches must be cleared whenever the target's memory could have changed without our knowledge - see
+         * TargetControllerComponent::clearMemoryCaches().
+         */
+        std::map<Targets::TargetMemoryType, TargetMemoryCache> memoryCachesByType;
+
+        /**
+         * A persistent shadow of the target's program memory. Program memory reads are serviced via the shadow, which
+         * survives target execution and is stored on disk between sessions. See the ProgramMemoryShadow class for more.
+         */
+        std::optional<ProgramMemoryShadow> programMemoryShadow;
+
         /**
          * Registers a handler function for a particular command type.
          * Only one handler function can be registered per command type.
@@ -215,18 +270,40 @@ namespace Bloom::TargetController
         std::map<std::string, std::function<std::unique_ptr<Targets::Target>()>> getSupportedTargets();
 
         /**
-         * Processes any pending commands in the queue.
+         * The maximum number of bytes to read from the target in a single operation, when servicing a
+         * ReadTargetMemory command of lower than CommandPriority::INTERACTIVE_DEBUG priority. Between each slice,
+         * any queued commands of higher priority will be serviced.
+         */
+        static constexpr std::uint32_t MEMORY_READ_SLICE_SIZE = 512;
+
+        /**
+         * Processes any pending commands in the queue, in order of priority.
+         *
+         * @param higherThan
+         *  If set, only commands of a higher priority than this will be processed.
+         */
+        void processQueuedCommands(std::optional<Commands::CommandPriority> higherThan = std::nullopt);
+
+        /**
+         * Removes and returns the next command to be processed, from the command queues.
+         *
+         * @param higherThan
+         *  If set, only commands of a higher priority than this will be considered.
+         *
+         * @return
+         *  The next command, or std::nullopt if there are no eligible commands in the queues.
          */
-        void processQueuedCommands();
+        static std::optional<QueuedCommand> popNextQueuedCommand(std::optional<Commands::CommandPriority> higherThan);
 
         /**
-         * Records a response for a given command ID. Notifies the TargetControllerComponent::responsesByCommandIdCv
-         * condition variable of the new response.
+         * Checks if the given command can be serviced in the current state, and invokes the registered handler.
          *
-         * @param commandId
-         * @param response
+         * This function will throw an exception if the command cannot be serviced, or if the handler fails.
+         *
+         * @param command
+         * @return
          */
-        void registerCommandResponse(Commands::CommandIdType commandId, std::unique_ptr<Responses::Response> response);
+        std::unique_ptr<Responses::Response> processCommand(Commands::Command& command);
 
         /**
          * Installs Bloom's udev rules on user's machine. Rules are copied from build/Distribution/Resources/UdevRules
@@ -284,16 +361,75 @@ namespace Bloom::TargetController
             Targets::TargetMemoryType memoryType
         );
 
+        /**
+         * Constructs a memory cache for each of the target's memories.
+         */
+        void loadMemoryCaches();
+
+        /**
+         * Constructs the program memory shadow and loads any previously saved shadow image from disk.
+         */
+        void loadProgramMemoryShadow();
+
+        /**
+         * Drops all cached target memory. Must be called whenever the target's memory could have changed without our
+         * knowledge (upon resuming target execution, stepping, resetting, etc).
+         */
+        void clearMemoryCaches();
+
+        /**
+         * Reads memory from the target, via the appropriate memory cache, where possible.
+         *
+         * Program memory reads are serviced via the program memory shadow, regardless of the target's state.
+         *
+         * Reads are only serviced via the cache when the target is stopped and not in programming mode, and when the
+         * entire address range resides within the target's memory descriptor for the given memory type. Everything
+         * else goes straight to the target.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param bytes
+         * @param excludedAddressRanges
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer readTargetMemory(
+            Targets::TargetMemoryType memoryType,
+            std::uint32_t startAddress,
+            std::uint32_t bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+        );
+
         /**
          * Should fire any events queued on the target.
          */
         void fireTargetEvents();
 
+        /**
+         * Determines how long the TargetController can wait on its notifier before it must check the target for state
+         * changes.
+         *
+         * If the target is not running, or it's able to notify us of state changes, there's no need to wake up
+         * periodically - we only need to wake up for incoming commands and events.
+         *
+         * @return
+         *  The maximum wait duration, or std::nullopt if the TargetController can wait indefinitely.
+         */
+        std::optional<std::chrono::milliseconds> getNotificationWaitTimeout() const;
+
         /**
          * Triggers a target reset and emits a TargetReset event.
          */
         void resetTarget();
 
+        /**
+         * Brings the breakpoints on the target in line with this->requestedBreakpointAddresses, removing and setting
+         * breakpoints in (at most) one batch each.
+         *
+         * This must be called before the target is resumed, stepped or programmed.
+         */
+        void commitBreakpoints();
+
         /**
          * Puts the target into programming mode and disables command handlers for debug commands (commands that serve
          * debug operations such as SetBreakpoint, ResumeTargetExecution, etc).
@@ -359,5 +495,6 @@ namespace Bloom::TargetController
         );
         std::unique_ptr<Responses::Response> handleEnableProgrammingMode(Commands::EnableProgrammingMode& command);
         std::unique_ptr<Responses::Response> handleDisableProgrammingMode(Commands::DisableProgrammingMode& command);
+        std::unique_ptr<Responses::CommandBatchResponses> handleCommandBatch(Commands::CommandBatch& command);
     };
 }
@@ -75,161 +75,296 @@ namespace Bloom::TargetController
     }
 
     TargetDescriptor TargetControllerConsole::getTargetDescriptor() {
-        return this->commandManager.sendCommandAndWaitForResponse(
-            std::make_unique<GetTargetDescriptor>(),
-            this->defaultTimeout
-        )->targetDescriptor;
+        return this->getTargetDescriptorAsync().get()->targetDescriptor;
     }
 
     TargetState TargetControllerConsole::getTargetState() {
-        return this->commandManager.sendCommandAndWaitForResponse(
-            std::make_unique<GetTargetState>(),
-            this->defaultTimeout
-        )->targetState;
+        return this->getTargetStateAsync().get()->targetState;
     }
 
     void TargetControllerConsole::stopTargetExecution() {
-        this->commandManager.sendCommandAndWaitForResponse(
+        this->stopTargetExecutionAsync().get();
+    }
+
+    void TargetControllerConsole::continueTargetExecution(std::optional<std::uint32_t> fromAddress) {
+        this->continueTargetExecutionAsync(fromAddress).get();
+    }
+
+    void TargetControllerConsole::stepTargetExecution(std::optional<std::uint32_t> fromAddress) {
+        this->stepTargetExecutionAsync(fromAddress).get();
+    }
+
+    TargetRegisters TargetControllerConsole::readRegisters(const TargetRegisterDescriptors& descriptors) {
+        return this->readRegistersAsync(descriptors).get()->registers;
+    }
+
+    void TargetControllerConsole::writeRegisters(const TargetRegisters& registers) {
+        this->writeRegistersAsync(registers).get();
+    }
+
+    TargetMemoryBuffer TargetControllerConsole::readMemory(
+        TargetMemoryType memoryType,
+        std::uint32_t startAddress,
+        std::uint32_t bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        return this->readMemoryAsync(memoryType, startAddress, bytes, excludedAddressRanges).get()->data;
+    }
+
+    void TargetControllerConsole::writeMemory(
+        TargetMemoryType memoryType,
+        std::uint32_t startAddress,
+        const TargetMemoryBuffer& buffer
+    ) {
+        this->writeMemoryAsync(memoryType, startAddress, buffer).get();
+    }
+
+    void TargetControllerConsole::setBreakpoint(TargetBreakpoint breakpoint) {
+        this->setBreakpointAsync(breakpoint).get();
+    }
+
+    void TargetControllerConsole::removeBreakpoint(TargetBreakpoint breakpoint) {
+        this->removeBreakpointAsync(breakpoint).get();
+    }
+
+    std::uint32_t TargetControllerConsole::getProgramCounter() {
+        return this->getProgramCounterAsync().get()->programCounter;
+    }
+
+    void TargetControllerConsole::setProgramCounter(std::uint32_t address) {
+        this->setProgramCounterAsync(address).get();
+    }
+
+    TargetPinStateMappingType TargetControllerConsole::getPinStates(int variantId) {
+        return this->getPinStatesAsync(variantId).get()->pinStatesByNumber;
+    }
+
+    void TargetControllerConsole::setPinState(TargetPinDescriptor pinDescriptor, TargetPinState pinState) {
+        this->setPinStateAsync(pinDescriptor, pinState).get();
+    }
+
+    std::uint32_t TargetControllerConsole::getStackPointer() {
+        return this->getStackPointerAsync().get()->stackPointer;
+    }
+
+    CommandBatchBuilder TargetControllerConsole::batch() {
+        return CommandBatchBuilder(this->commandManager, this->defaultTimeout);
+    }
+
+    void TargetControllerConsole::resetTarget() {
+        this->resetTargetAsync().get();
+    }
+
+    void TargetControllerConsole::enableProgrammingMode() {
+        this->enableProgrammingModeAsync().get();
+    }
+
+    void TargetControllerConsole::disableProgrammingMode() {
+        this->disableProgrammingModeAsync().get();
+    }
+
+    PendingResponse<GetTargetDescriptor> TargetControllerConsole::getTargetDescriptorAsync(
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
+            std::make_unique<GetTargetDescriptor>(),
+            timeout.value_or(this->defaultTimeout)
+        );
+    }
+
+    PendingResponse<GetTargetState> TargetControllerConsole::getTargetStateAsync(
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
+            std::make_unique<GetTargetState>(),
+            timeout.value_or(this->defaultTimeout)
+        );
+    }
+
+    PendingResponse<StopTargetExecution> TargetControllerConsole::stopTargetExecutionAsync(
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<StopTargetExecution>(),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    void TargetControllerConsole::continueTargetExecution(std::optional<std::uint32_t> fromAddress) {
+    PendingResponse<ResumeTargetExecution> TargetControllerConsole::continueTargetExecutionAsync(
+        std::optional<std::uint32_t> fromAddress,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
         auto resumeExecutionCommand = std::make_unique<ResumeTargetExecution>();
 
         if (fromAddress.has_value()) {
             resumeExecutionCommand->fromProgramCounter = fromAddress.value();
         }
 
-        this->commandManager.sendCommandAndWaitForResponse(
+        return this->commandManager.sendCommand(
             std::move(resumeExecutionCommand),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    void TargetControllerConsole::stepTargetExecution(std::optional<std::uint32_t> fromAddress) {
+    PendingResponse<StepTargetExecution> TargetControllerConsole::stepTargetExecutionAsync(
+        std::optional<std::uint32_t> fromAddress,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
         auto stepExecutionCommand = std::make_unique<StepTargetExecution>();
 
         if (fromAddress.has_value()) {
             stepExecutionCommand->fromProgramCounter = fromAddress.value();
         }
 
-        this->commandManager.sendCommandAndWaitForResponse(
+        return this->commandManager.sendCommand(
             std::move(stepExecutionCommand),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    TargetRegisters TargetControllerConsole::readRegisters(const TargetRegisterDescriptors& descriptors) {
-        return this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<ReadTargetRegisters> TargetControllerConsole::readRegistersAsync(
+        const TargetRegisterDescriptors& descriptors,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<ReadTargetRegisters>(descriptors),
-            this->defaultTimeout
-        )->registers;
+            timeout.value_or(this->defaultTimeout)
+        );
     }
 
-    void TargetControllerConsole::writeRegisters(const TargetRegisters& registers) {
-        this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<WriteTargetRegisters> TargetControllerConsole::writeRegistersAsync(
+        const TargetRegisters& registers,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<WriteTargetRegisters>(registers),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    TargetMemoryBuffer TargetControllerConsole::readMemory(
+    PendingResponse<ReadTargetMemory> TargetControllerConsole::readMemoryAsync(
         TargetMemoryType memoryType,
         std::uint32_t startAddress,
         std::uint32_t bytes,
-        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges,
+        std::optional<std::chrono::milliseconds> timeout
     ) {
-        return this->commandManager.sendCommandAndWaitForResponse(
+        return this->commandManager.sendCommand(
             std::make_unique<ReadTargetMemory>(
                 memoryType,
                 startAddress,
                 bytes,
                 excludedAddressRanges
             ),
-            this->defaultTimeout
-        )->data;
+            timeout.value_or(this->defaultTimeout)
+        );
     }
 
-    void TargetControllerConsole::writeMemory(
+    PendingResponse<WriteTargetMemory> TargetControllerConsole::writeMemoryAsync(
         TargetMemoryType memoryType,
         std::uint32_t startAddress,
-        const TargetMemoryBuffer& buffer
+        const TargetMemoryBuffer& buffer,
+        std::optional<std::chrono::milliseconds> timeout
     ) {
-        this->commandManager.sendCommandAndWaitForResponse(
+        return this->commandManager.sendCommand(
             std::make_unique<WriteTargetMemory>(memoryType, startAddress, buffer),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    void TargetControllerConsole::setBreakpoint(TargetBreakpoint breakpoint) {
-        this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<SetBreakpoint> TargetControllerConsole::setBreakpointAsync(
+        TargetBreakpoint breakpoint,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<SetBreakpoint>(breakpoint),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    void TargetControllerConsole::removeBreakpoint(TargetBreakpoint breakpoint) {
-        this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<RemoveBreakpoint> TargetControllerConsole::removeBreakpointAsync(
+        TargetBreakpoint breakpoint,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<RemoveBreakpoint>(breakpoint),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    std::uint32_t TargetControllerConsole::getProgramCounter() {
-        return this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<GetTargetProgramCounter> TargetControllerConsole::getProgramCounterAsync(
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<GetTargetProgramCounter>(),
-            this->defaultTimeout
-        )->programCounter;
+            timeout.value_or(this->defaultTimeout)
+        );
     }
 
-    void TargetControllerConsole::setProgramCounter(std::uint32_t address) {
-        this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<SetTargetProgramCounter> TargetControllerConsole::setProgramCounterAsync(
+        std::uint32_t address,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<SetTargetProgramCounter>(address),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    TargetPinStateMappingType TargetControllerConsole::getPinStates(int variantId) {
-        return this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<GetTargetPinStates> TargetControllerConsole::getPinStatesAsync(
+        int variantId,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<GetTargetPinStates>(variantId),
-            this->defaultTimeout
-        )->pinStatesByNumber;
+            timeout.value_or(this->defaultTimeout)
+        );
     }
 
-    void TargetControllerConsole::setPinState(TargetPinDescriptor pinDescriptor, TargetPinState pinState) {
-        this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<SetTargetPinState> TargetControllerConsole::setPinStateAsync(
+        TargetPinDescriptor pinDescriptor,
+        TargetPinState pinState,
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<SetTargetPinState>(pinDescriptor, pinState),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    std::uint32_t TargetControllerConsole::getStackPointer() {
-        return this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<GetTargetStackPointer> TargetControllerConsole::getStackPointerAsync(
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<GetTargetStackPointer>(),
-            this->defaultTimeout
-        )->stackPointer;
+            timeout.value_or(this->defaultTimeout)
+        );
     }
 
-    void TargetControllerConsole::resetTarget() {
-        this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<ResetTarget> TargetControllerConsole::resetTargetAsync(
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<ResetTarget>(),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    void TargetControllerConsole::enableProgrammingMode() {
-        this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<EnableProgrammingMode> TargetControllerConsole::enableProgrammingModeAsync(
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<EnableProgrammingMode>(),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 
-    void TargetControllerConsole::disableProgrammingMode() {
-        this->commandManager.sendCommandAndWaitForResponse(
+    PendingResponse<DisableProgrammingMode> TargetControllerConsole::disableProgrammingModeAsync(
+        std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return this->commandManager.sendCommand(
             std::make_unique<DisableProgrammingMode>(),
-            this->defaultTimeout
+            timeout.value_or(this->defaultTimeout)
         );
     }
 }
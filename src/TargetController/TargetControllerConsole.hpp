@@ -5,8 +5,31 @@
 #include <optional>
 
 #include "CommandManager.hpp"
+#include "CommandBatchBuilder.hpp"
+#include "PendingResponse.hpp"
 #include "TargetControllerState.hpp"
 
+// Commands
+#include "Commands/GetTargetDescriptor.hpp"
+#include "Commands/GetTargetState.hpp"
+#include "Commands/StopTargetExecution.hpp"
+#include "Commands/ResumeTargetExecution.hpp"
+#include "Commands/ResetTarget.hpp"
+#include "Commands/ReadTargetRegisters.hpp"
+#include "Commands/WriteTargetRegisters.hpp"
+#include "Commands/ReadTargetMemory.hpp"
+#include "Commands/WriteTargetMemory.hpp"
+#include "Commands/StepTargetExecution.hpp"
+#include "Commands/SetBreakpoint.hpp"
+#include "Commands/RemoveBreakpoint.hpp"
+#include "Commands/SetTargetProgramCounter.hpp"
+#include "Commands/GetTargetPinStates.hpp"
+#include "Commands/SetTargetPinState.hpp"
+#include "Commands/GetTargetStackPointer.hpp"
+#include "Commands/GetTargetProgramCounter.hpp"
+#include "Commands/EnableProgrammingMode.hpp"
+#include "Commands/DisableProgrammingMode.hpp"
+
 #include "src/Targets/TargetState.hpp"
 #include "src/Targets/TargetRegister.hpp"
 #include "src/Targets/TargetMemory.hpp"
@@ -30,6 +53,15 @@ namespace Bloom::TargetController
             this->defaultTimeout = timeout;
         }
 
+        /**
+         * Sets the priority of all commands issued via this console. See the Commands::CommandPriority enum for more.
+         *
+         * @param priority
+         */
+        void setCommandPriority(Commands::CommandPriority priority) {
+            this->commandManager.setCommandPriority(priority);
+        }
+
         /**
          * Requests the current TargetController state from the TargetController. The TargetController should always
          * respond to such a request, even when it's in a suspended state.
@@ -178,6 +210,14 @@ namespace Bloom::TargetController
          */
         std::uint32_t getStackPointer();
 
+        /**
+         * Constructs a CommandBatchBuilder, for issuing multiple commands to the TargetController in a single round
+         * trip. See the CommandBatchBuilder class for more.
+         *
+         * @return
+         */
+        CommandBatchBuilder batch();
+
         /**
          * Triggers a reset on the target. The target will be held in a stopped state.
          */
@@ -197,6 +237,109 @@ namespace Bloom::TargetController
          */
         void disableProgrammingMode();
 
+        /*
+         * Asynchronous variants of the functions above.
+         *
+         * These functions issue the command to the TargetController and return immediately, with a PendingResponse.
+         * The response can be collected via PendingResponse::get(), or the command can be cancelled via
+         * PendingResponse::cancel(). See the PendingResponse class for more.
+         *
+         * If the timeout parameter is not provided, the console's default timeout will be used.
+         */
+
+        PendingResponse<Commands::GetTargetDescriptor> getTargetDescriptorAsync(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::GetTargetState> getTargetStateAsync(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::StopTargetExecution> stopTargetExecutionAsync(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::ResumeTargetExecution> continueTargetExecutionAsync(
+            std::optional<std::uint32_t> fromAddress,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::StepTargetExecution> stepTargetExecutionAsync(
+            std::optional<std::uint32_t> fromAddress,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::ReadTargetRegisters> readRegistersAsync(
+            const Targets::TargetRegisterDescriptors& descriptors,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::WriteTargetRegisters> writeRegistersAsync(
+            const Targets::TargetRegisters& registers,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::ReadTargetMemory> readMemoryAsync(
+            Targets::TargetMemoryType memoryType,
+            std::uint32_t startAddress,
+            std::uint32_t bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges = {},
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::WriteTargetMemory> writeMemoryAsync(
+            Targets::TargetMemoryType memoryType,
+            std::uint32_t startAddress,
+            const Targets::TargetMemoryBuffer& buffer,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::SetBreakpoint> setBreakpointAsync(
+            Targets::TargetBreakpoint breakpoint,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::RemoveBreakpoint> removeBreakpointAsync(
+            Targets::TargetBreakpoint breakpoint,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::GetTargetProgramCounter> getProgramCounterAsync(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::SetTargetProgramCounter> setProgramCounterAsync(
+            std::uint32_t address,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::GetTargetPinStates> getPinStatesAsync(
+            int variantId,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::SetTargetPinState> setPinStateAsync(
+            Targets::TargetPinDescriptor pinDescriptor,
+            Targets::TargetPinState pinState,
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::GetTargetStackPointer> getStackPointerAsync(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::ResetTarget> resetTargetAsync(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::EnableProgrammingMode> enableProgrammingModeAsync(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
+        PendingResponse<Commands::DisableProgrammingMode> disableProgrammingModeAsync(
+            std::optional<std::chrono::milliseconds> timeout = std::nullopt
+        );
+
     private:
         CommandManager commandManager = CommandManager();
 
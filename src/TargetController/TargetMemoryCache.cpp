@@ -0,0 +1,209 @@
+#include "TargetMemoryCache.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Bloom::TargetController
+{
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetMemoryAddressRange;
+
+    TargetMemoryCache::TargetMemoryCache(const Targets::TargetMemoryDescriptor& memoryDescriptor)
+        : memoryDescriptor(memoryDescriptor)
+    {
+        if (memoryDescriptor.pageSize.has_value() && memoryDescriptor.pageSize.value() > 0) {
+            this->pageSize = memoryDescriptor.pageSize.value();
+        }
+    }
+
+    bool TargetMemoryCache::contains(std::uint32_t startAddress, std::uint32_t bytes) const {
+        return bytes > 0 && this->memoryDescriptor.addressRange.contains(
+            TargetMemoryAddressRange(startAddress, startAddress + bytes - 1)
+        );
+    }
+
+    TargetMemoryBuffer TargetMemoryCache::fetch(
+        std::uint32_t startAddress,
+        std::uint32_t bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges,
+        const ReadCallback& readCallback
+    ) {
+        const auto endAddress = startAddress + bytes - 1;
+        const auto firstPageIndex = this->getPageIndex(startAddress);
+        const auto lastPageIndex = this->getPageIndex(endAddress);
+
+        const auto pageIsExcluded = [this, &excludedAddressRanges] (std::uint32_t pageIndex) {
+            const auto pageStartAddress = this->getPageStartAddress(pageIndex);
+            const auto pageEndAddress = this->getPageEndAddress(pageIndex);
+
+            return std::any_of(
+                excludedAddressRanges.begin(),
+                excludedAddressRanges.end(),
+                [pageStartAddress, pageEndAddress] (const TargetMemoryAddressRange& excludedRange) {
+                    return excludedRange.startAddress <= pageEndAddress
+                        && excludedRange.endAddress >= pageStartAddress;
+                }
+            );
+        };
+
+        /*
+         * Pages that contain excluded addresses cannot be stored in the cache, as the excluded bytes will have been
+         * masked. We hold on to them here, for the duration of this fetch.
+         */
+        auto uncachablePagesByIndex = std::map<std::uint32_t, TargetMemoryBuffer>();
+
+        auto pageIndex = firstPageIndex;
+        while (pageIndex <= lastPageIndex) {
+            if (this->pagesByIndex.contains(pageIndex)) {
+                this->hitCount++;
+                pageIndex++;
+                continue;
+            }
+
+            // Read this page, along with any consecutive missing pages, in a single operation
+            const auto missingRunStartIndex = pageIndex;
+            while (pageIndex <= lastPageIndex && !this->pagesByIndex.contains(pageIndex)) {
+                pageIndex++;
+            }
+            const auto missingRunEndIndex = pageIndex - 1;
+
+            const auto readStartAddress = this->getPageStartAddress(missingRunStartIndex);
+            const auto readBytes = this->getPageEndAddress(missingRunEndIndex) - readStartAddress + 1;
+            const auto readData = readCallback(readStartAddress, readBytes);
+
+            if (readData.size() != readBytes) {
+                throw Exceptions::Exception("Unexpected number of bytes returned from target memory read");
+            }
+
+            for (auto missingIndex = missingRunStartIndex; missingIndex <= missingRunEndIndex; missingIndex++) {
+                const auto pageOffset = this->getPageStartAddress(missingIndex) - readStartAddress;
+                const auto pageEndOffset = this->getPageEndAddress(missingIndex) - readStartAddress + 1;
+
+                auto page = TargetMemoryBuffer(readData.begin() + pageOffset, readData.begin() + pageEndOffset);
+
+                if (pageIsExcluded(missingIndex)) {
+                    uncachablePagesByIndex.insert(std::pair(missingIndex, std::move(page)));
+
+                } else {
+                    this->pagesByIndex.insert(std::pair(missingIndex, std::move(page)));
+                }
+
+                this->missCount++;
+            }
+        }
+
+        auto output = TargetMemoryBuffer();
+        output.reserve(bytes);
+
+        for (pageIndex = firstPageIndex; pageIndex <= lastPageIndex; pageIndex++) {
+            const auto cachedPageIt = this->pagesByIndex.find(pageIndex);
+            const auto& page = cachedPageIt != this->pagesByIndex.end()
+                ? cachedPageIt->second
+                : uncachablePagesByIndex.at(pageIndex);
+
+            const auto pageStartAddress = this->getPageStartAddress(pageIndex);
+            const auto copyStartAddress = std::max(startAddress, pageStartAddress);
+            const auto copyEndAddress = std::min(endAddress, this->getPageEndAddress(pageIndex));
+
+            output.insert(
+                output.end(),
+                page.begin() + (copyStartAddress - pageStartAddress),
+                page.begin() + (copyEndAddress - pageStartAddress + 1)
+            );
+        }
+
+        // Cached pages may hold the real values of excluded bytes (read on behalf of an earlier command)
+        for (const auto& excludedRange : excludedAddressRanges) {
+            if (excludedRange.startAddress > endAddress || excludedRange.endAddress < startAddress) {
+                continue;
+            }
+
+            const auto maskStartAddress = std::max(startAddress, excludedRange.startAddress);
+            const auto maskEndAddress = std::min(endAddress, excludedRange.endAddress);
+
+            std::fill(
+                output.begin() + (maskStartAddress - startAddress),
+                output.begin() + (maskEndAddress - startAddress + 1),
+                0x00
+            );
+        }
+
+        return output;
+    }
+
+    void TargetMemoryCache::update(std::uint32_t startAddress, const TargetMemoryBuffer& buffer) {
+        if (!this->contains(startAddress, static_cast<std::uint32_t>(buffer.size()))) {
+            // Partially cacheable writes are rare - we just drop whatever we hold for the affected range.
+            this->invalidate(startAddress, static_cast<std::uint32_t>(buffer.size()));
+            return;
+        }
+
+        const auto endAddress = static_cast<std::uint32_t>(startAddress + buffer.size() - 1);
+        const auto lastPageIndex = this->getPageIndex(endAddress);
+
+        for (auto pageIndex = this->getPageIndex(startAddress); pageIndex <= lastPageIndex; pageIndex++) {
+            const auto pageStartAddress = this->getPageStartAddress(pageIndex);
+            const auto pageEndAddress = this->getPageEndAddress(pageIndex);
+            const auto copyStartAddress = std::max(startAddress, pageStartAddress);
+            const auto copyEndAddress = std::min(endAddress, pageEndAddress);
+
+            if (copyStartAddress == pageStartAddress && copyEndAddress == pageEndAddress) {
+                this->pagesByIndex[pageIndex] = TargetMemoryBuffer(
+                    buffer.begin() + (pageStartAddress - startAddress),
+                    buffer.begin() + (pageEndAddress - startAddress + 1)
+                );
+                continue;
+            }
+
+            const auto cachedPageIt = this->pagesByIndex.find(pageIndex);
+            if (cachedPageIt == this->pagesByIndex.end()) {
+                continue;
+            }
+
+            auto& page = cachedPageIt->second;
+
+            std::copy(
+                buffer.begin() + (copyStartAddress - startAddress),
+                buffer.begin() + (copyEndAddress - startAddress + 1),
+                page.begin() + (copyStartAddress - pageStartAddress)
+            );
+        }
+    }
+
+    void TargetMemoryCache::invalidate(std::uint32_t startAddress, std::uint32_t bytes) {
+        if (bytes == 0 || this->pagesByIndex.empty()) {
+            return;
+        }
+
+        const auto& addressRange = this->memoryDescriptor.addressRange;
+        const auto endAddress = startAddress + bytes - 1;
+
+        if (startAddress > addressRange.endAddress || endAddress < addressRange.startAddress) {
+            return;
+        }
+
+        const auto firstPageIndex = this->getPageIndex(std::max(startAddress, addressRange.startAddress));
+        const auto lastPageIndex = this->getPageIndex(std::min(endAddress, addressRange.endAddress));
+
+        this->pagesByIndex.erase(
+            this->pagesByIndex.lower_bound(firstPageIndex),
+            this->pagesByIndex.upper_bound(lastPageIndex)
+        );
+    }
+
+    void TargetMemoryCache::insertPage(std::uint32_t pageIndex, TargetMemoryBuffer page) {
+        const auto pageCount = (this->memoryDescriptor.size() + this->pageSize - 1) / this->pageSize;
+
+        if (
+            pageIndex >= pageCount
+            || page.size() != (this->getPageEndAddress(pageIndex) - this->getPageStartAddress(pageIndex) + 1)
+        ) {
+            throw Exceptions::Exception("Invalid page (index: " + std::to_string(pageIndex) + ")");
+        }
+
+        this->pagesByIndex[pageIndex] = std::move(page);
+    }
+
+    void TargetMemoryCache::clear() {
+        this->pagesByIndex.clear();
+    }
+}
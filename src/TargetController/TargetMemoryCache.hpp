@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <functional>
+#include <algorithm>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Bloom::TargetController
+{
+    /**
+     * A page-granular cache of a single target memory.
+     *
+     * The TargetController uses these caches to service repeated memory reads whilst the target is stopped, without
+     * having to go back to the debug tool. The caches know nothing of the target's state - it's up to the
+     * TargetController to clear them whenever the target's memory could have changed without its knowledge (upon
+     * resuming execution, stepping, resetting, etc).
+     *
+     * Only addresses within the memory descriptor's address range can be cached.
+     */
+    class TargetMemoryCache
+    {
+    public:
+        /**
+         * The page size to use for memories that have no page size of their own (such as RAM).
+         */
+        static constexpr std::uint32_t DEFAULT_PAGE_SIZE = 64;
+
+        /**
+         * Reads a contiguous block of memory from the target, starting at the given address.
+         */
+        using ReadCallback = std::function<Targets::TargetMemoryBuffer(std::uint32_t, std::uint32_t)>;
+
+        explicit TargetMemoryCache(const Targets::TargetMemoryDescriptor& memoryDescriptor);
+
+        /**
+         * Checks if the given address range falls within the cached memory.
+         *
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
+        [[nodiscard]] bool contains(std::uint32_t startAddress, std::uint32_t bytes) const;
+
+        /**
+         * Fetches memory from the cache, reading any missing pages from the target via the given callback.
+         *
+         * Consecutive missing pages are read from the target in a single operation. Pages containing any excluded
+         * addresses are never stored in the cache. Bytes at excluded addresses will be returned as 0x00, mirroring
+         * the behaviour of the masked memory reads performed by the debug tool drivers.
+         *
+         * @param startAddress
+         * @param bytes
+         * @param excludedAddressRanges
+         * @param readCallback
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer fetch(
+            std::uint32_t startAddress,
+            std::uint32_t bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges,
+            const ReadCallback& readCallback
+        );
+
+        /**
+         * Updates the cache with data that has just been written to the target. Pages that are entirely covered by
+         * the written data are inserted into the cache. Partially covered pages are only updated if they're already
+         * cached.
+         *
+         * @param startAddress
+         * @param buffer
+         */
+        void update(std::uint32_t startAddress, const Targets::TargetMemoryBuffer& buffer);
+
+        /**
+         * Drops any cached pages that hold data within the given address range.
+         *
+         * @param startAddress
+         * @param bytes
+         */
+        void invalidate(std::uint32_t startAddress, std::uint32_t bytes);
+
+        /**
+         * Drops all cached pages.
+         */
+        void clear();
+
+        /**
+         * Inserts a single page into the cache, replacing any existing page at the given index.
+         *
+         * @param pageIndex
+         * @param page
+         */
+        void insertPage(std::uint32_t pageIndex, Targets::TargetMemoryBuffer page);
+
+        [[nodiscard]] const std::map<std::uint32_t, Targets::TargetMemoryBuffer>& getPagesByIndex() const {
+            return this->pagesByIndex;
+        }
+
+        [[nodiscard]] std::uint32_t getPageSize() const {
+            return this->pageSize;
+        }
+
+        [[nodiscard]] bool isEmpty() const {
+            return this->pagesByIndex.empty();
+        }
+
+        [[nodiscard]] std::uint64_t getHitCount() const {
+            return this->hitCount;
+        }
+
+        [[nodiscard]] std::uint64_t getMissCount() const {
+            return this->missCount;
+        }
+
+    private:
+        Targets::TargetMemoryDescriptor memoryDescriptor;
+        std::uint32_t pageSize = TargetMemoryCache::DEFAULT_PAGE_SIZE;
+
+        /**
+         * Cached pages, mapped by page index (relative to the start of the memory).
+         */
+        std::map<std::uint32_t, Targets::TargetMemoryBuffer> pagesByIndex;
+
+        /**
+         * Number of pages served from the cache, and number of pages that had to be read from the target.
+         */
+        std::uint64_t hitCount = 0;
+        std::uint64_t missCount = 0;
+
+        [[nodiscard]] std::uint32_t getPageIndex(std::uint32_t address) const {
+            return (address - this->memoryDescriptor.addressRange.startAddress) / this->pageSize;
+        }
+
+        [[nodiscard]] std::uint32_t getPageStartAddress(std::uint32_t pageIndex) const {
+            return this->memoryDescriptor.addressRange.startAddress + (pageIndex * this->pageSize);
+        }
+
+        [[nodiscard]] std::uint32_t getPageEndAddress(std::uint32_t pageIndex) const {
+            return std::min(
+                this->getPageStartAddress(pageIndex) + this->pageSize - 1,
+                this->memoryDescriptor.addressRange.endAddress
+            );
+        }
+    };
+}
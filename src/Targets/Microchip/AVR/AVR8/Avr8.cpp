@@ -1,6 +1,7 @@
 #include "Avr8.hpp"
 
 #include <cassert>
+#include <algorithm>
 #include <bitset>
 #include <limits>
 #include <thread>
@@ -256,6 +257,14 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         this->avr8DebugInterface->clearBreakpoint(address);
     }
 
+    void Avr8::setBreakpoints(const std::set<std::uint32_t>& addresses) {
+        this->avr8DebugInterface->setBreakpoints(std::vector(addresses.begin(), addresses.end()));
+    }
+
+    void Avr8::removeBreakpoints(const std::set<std::uint32_t>& addresses) {
+        this->avr8DebugInterface->clearBreakpoints(std::vector(addresses.begin(), addresses.end()));
+    }
+
     void Avr8::clearAllBreakpoints() {
         this->avr8DebugInterface->clearAllBreakpoints();
     }
@@ -323,6 +332,14 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
     }
 
     void Avr8::writeMemory(TargetMemoryType memoryType, std::uint32_t startAddress, const TargetMemoryBuffer& buffer) {
+        if (
+            memoryType == TargetMemoryType::FLASH && this->programmingSession.has_value()
+            && this->targetConfig->differentialProgramming
+            && this->avr8DebugInterface->pageGranularProgrammingSupported()
+        ) {
+            return this->writeProgramMemoryDifferentially(startAddress, buffer);
+        }
+
         if (
             memoryType == TargetMemoryType::FLASH && this->programmingSession.has_value()
             && this->targetConfig->physicalInterface != PhysicalInterface::DEBUG_WIRE
@@ -377,6 +394,10 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         return this->avr8DebugInterface->getTargetState();
     }
 
+    bool Avr8::setStateChangeNotifier(NotifierInterface* notifier) {
+        return this->avr8DebugInterface->setTargetStateChangeNotifier(notifier);
+    }
+
     std::uint32_t Avr8::getProgramCounter() {
         return this->avr8DebugInterface->getProgramCounter();
     }
@@ -967,6 +988,52 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         }
     }
 
+    void Avr8::writeProgramMemoryDifferentially(std::uint32_t startAddress, const TargetMemoryBuffer& buffer) {
+        if (buffer.empty()) {
+            return;
+        }
+
+        const auto pageSize = this->targetParameters->flashPageSize.value();
+        const auto endAddress = static_cast<std::uint32_t>(startAddress + buffer.size() - 1);
+
+        const auto alignedStartAddress = startAddress - (startAddress % pageSize);
+        const auto alignedBytes = (((endAddress - alignedStartAddress) / pageSize) + 1) * pageSize;
+
+        const auto currentData = this->avr8DebugInterface->readMemory(
+            TargetMemoryType::FLASH,
+            alignedStartAddress,
+            alignedBytes
+        );
+
+        auto newData = currentData;
+        std::copy(buffer.begin(), buffer.end(), newData.begin() + (startAddress - alignedStartAddress));
+
+        auto pagesWritten = std::uint32_t(0);
+
+        for (auto offset = std::uint32_t(0); offset < alignedBytes; offset += pageSize) {
+            const auto newPageBeginIt = newData.begin() + offset;
+            const auto newPageEndIt = newPageBeginIt + pageSize;
+
+            if (std::equal(newPageBeginIt, newPageEndIt, currentData.begin() + offset)) {
+                continue;
+            }
+
+            this->avr8DebugInterface->eraseProgramMemoryPage(alignedStartAddress + offset);
+            this->avr8DebugInterface->writeMemory(
+                TargetMemoryType::FLASH,
+                alignedStartAddress + offset,
+                TargetMemoryBuffer(newPageBeginIt, newPageEndIt)
+            );
+
+            pagesWritten++;
+        }
+
+        Logger::debug(
+            "Differential programming - wrote " + std::to_string(pagesWritten) + " of "
+                + std::to_string(alignedBytes / pageSize) + " page(s)"
+        );
+    }
+
     ProgramMemorySection Avr8::getProgramMemorySectionFromAddress(std::uint32_t address) {
         return this->targetParameters->bootSectionStartAddress.has_value()
             && address >= this->targetParameters->bootSectionStartAddress.value()
@@ -93,6 +93,8 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
 
         void setBreakpoint(std::uint32_t address) override;
         void removeBreakpoint(std::uint32_t address) override;
+        void setBreakpoints(const std::set<std::uint32_t>& addresses) override;
+        void removeBreakpoints(const std::set<std::uint32_t>& addresses) override;
         void clearAllBreakpoints() override;
 
         void writeRegisters(TargetRegisters registers) override;
@@ -111,6 +113,7 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
         ) override;
 
         TargetState getState() override;
+        bool setStateChangeNotifier(NotifierInterface* notifier) override;
 
         std::uint32_t getProgramCounter() override;
         TargetRegister getProgramCounterRegister();
@@ -191,5 +194,16 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
          * @return
          */
         ProgramMemorySection getProgramMemorySectionFromAddress(std::uint32_t address);
+
+        /**
+         * Writes to program memory, one page at a time, skipping any pages that already hold the desired data.
+         *
+         * The affected pages are read from the target and compared with the new data. Only the pages that differ are
+         * erased and written to.
+         *
+         * @param startAddress
+         * @param buffer
+         */
+        void writeProgramMemoryDifferentially(std::uint32_t startAddress, const TargetMemoryBuffer& buffer);
     };
 }
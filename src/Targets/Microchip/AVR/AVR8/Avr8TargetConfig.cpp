@@ -44,5 +44,13 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
                 "targetPowerCycleDelay"
             ).toInt(static_cast<int>(this->targetPowerCycleDelay.count())));
         }
+
+        if (targetConfig.jsonObject.contains("differentialProgramming")) {
+            this->differentialProgramming = targetConfig.jsonObject.value("differentialProgramming").toBool();
+        }
+
+        if (targetConfig.jsonObject.contains("calibrateMemoryAccess")) {
+            this->calibrateMemoryAccess = targetConfig.jsonObject.value("calibrateMemoryAccess").toBool();
+        }
     }
 }
@@ -67,6 +67,35 @@ namespace Bloom::Targets::Microchip::Avr::Avr8Bit
          */
         std::chrono::milliseconds targetPowerCycleDelay = std::chrono::milliseconds(250);
 
+        /**
+         * When programming the target, Bloom can compare the new program memory data with the target's current
+         * program memory, and only erase & write the pages that have changed. Otherwise, the entire program memory
+         * (or the relevant section) is erased before programming, and every page is written.
+         *
+         * This is only possible with physical interfaces that allow for page granular programming (see
+         * Avr8DebugInterface::pageGranularProgrammingSupported()). For all other interfaces, this parameter is
+         * ignored.
+         *
+         * NOTE: With this parameter enabled, nothing is erased up front. Pages that fall outside of the written
+         * regions keep their current contents, as opposed to being cleared by a section erase. The GDB server
+         * erases any regions requested by GDB, but other programming sources are not covered.
+         *
+         * This parameter is optional. The function is disabled by default.
+         */
+        bool differentialProgramming = false;
+
+        /**
+         * Some debug tools can service much larger memory reads than we'd assume by default. When this parameter is
+         * enabled, Bloom will probe the debug tool, upon activation, for the largest reliable read size and the cost
+         * of each read, for each memory type. The results are cached (per debug tool and physical interface) in the
+         * project's settings directory, so the probing only takes place once.
+         *
+         * NOTE: Currently, this parameter is only honoured by the EdbgAvr8Interface.
+         *
+         * This parameter is optional. The function is disabled by default.
+         */
+        bool calibrateMemoryAccess = false;
+
         explicit Avr8TargetConfig(const TargetConfig& targetConfig);
 
     private:
@@ -16,6 +16,7 @@
 #include "TargetBreakpoint.hpp"
 
 #include "src/DebugToolDrivers/DebugTool.hpp"
+#include "src/Helpers/NotifierInterface.hpp"
 
 namespace Bloom::Targets
 {
@@ -211,6 +212,34 @@ namespace Bloom::Targets
          */
         virtual void removeBreakpoint(std::uint32_t address) = 0;
 
+        /**
+         * Should set breakpoints on the target, at the given addresses.
+         *
+         * The default implementation sets each breakpoint individually. Targets that can set numerous breakpoints in
+         * a single operation should override this.
+         *
+         * @param addresses
+         */
+        virtual void setBreakpoints(const std::set<std::uint32_t>& addresses) {
+            for (const auto address : addresses) {
+                this->setBreakpoint(address);
+            }
+        }
+
+        /**
+         * Should remove the breakpoints at the given addresses.
+         *
+         * The default implementation removes each breakpoint individually. Targets that can remove numerous
+         * breakpoints in a single operation should override this.
+         *
+         * @param addresses
+         */
+        virtual void removeBreakpoints(const std::set<std::uint32_t>& addresses) {
+            for (const auto address : addresses) {
+                this->removeBreakpoint(address);
+            }
+        }
+
         /**
          * Should clear all breakpoints on the target.
          *
@@ -267,6 +296,23 @@ namespace Bloom::Targets
          */
         virtual TargetState getState() = 0;
 
+        /**
+         * Targets that can report execution state changes (e.g. the target stopping on a breakpoint) as they occur,
+         * should invoke NotifierInterface::notify() on the given notifier, upon every such change.
+         *
+         * This allows the TargetController to wait on its notifier, as opposed to periodically polling the target
+         * (via Target::getState()) whilst it's running.
+         *
+         * @param notifier
+         *
+         * @return
+         *  True if the target will notify the given notifier of state changes. False if the target's state must be
+         *  polled.
+         */
+        virtual bool setStateChangeNotifier(NotifierInterface* notifier) {
+            return false;
+        }
+
         /**
          * Should fetch the current program counter value.
          *
@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "src/DebugServer/Gdb/HexCodec.hpp"
+
+using Bloom::DebugServer::Gdb::HexCodec;
+
+/*
+ * Times HexCodec against the std::stringstream/std::stoi implementation that Packet::toHex() and
+ * Packet::hexToData() used before it, for buffers of 1 to 16 KiB.
+ *
+ * This isn't registered with CTest, as its results depend on the host. Run it directly:
+ *
+ *  ./GdbHexCodecBenchmark
+ */
+namespace
+{
+    constexpr auto ITERATIONS = 200;
+
+    std::string streamEncode(const std::vector<unsigned char>& data) {
+        std::stringstream stream;
+        stream << std::hex << std::setfill('0');
+
+        for (const auto& byte : data) {
+            stream << std::setw(2) << static_cast<unsigned int>(byte);
+        }
+
+        return stream.str();
+    }
+
+    std::vector<unsigned char> stoiDecode(const std::string& hexData) {
+        std::vector<unsigned char> output;
+
+        for (auto i = std::size_t(0); i < hexData.size(); i += 2) {
+            auto hexByte = hexData.substr(i, 2);
+            output.push_back(static_cast<unsigned char>(std::stoi(hexByte, nullptr, 16)));
+        }
+
+        return output;
+    }
+
+    /**
+     * Runs `function` ITERATIONS times and returns the average time per byte, in nanoseconds.
+     *
+     * The result of each run is folded into `sink`, so that the compiler can't discard the work.
+     */
+    template<class FunctionType>
+    double timePerByte(std::size_t bytes, std::size_t& sink, FunctionType function) {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (auto i = 0; i < ITERATIONS; i++) {
+            sink += function().size();
+        }
+
+        const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+        return elapsed.count() / (static_cast<double>(ITERATIONS) * static_cast<double>(bytes));
+    }
+}
+
+int main() {
+    auto sink = std::size_t(0);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "bytes\tstream encode\tcodec encode\tstoi decode\tcodec decode\t(ns per byte)" << std::endl;
+
+    for (auto bytes = std::size_t(1024); bytes <= 16384; bytes *= 2) {
+        auto data = std::vector<unsigned char>(bytes);
+
+        for (auto i = std::size_t(0); i < bytes; i++) {
+            data[i] = static_cast<unsigned char>((i * 31) + 7);
+        }
+
+        const auto hexData = HexCodec::encode(data);
+
+        if (hexData != streamEncode(data) || HexCodec::decode(hexData) != stoiDecode(hexData)) {
+            std::cerr << "HexCodec output differs from the reference implementation" << std::endl;
+            return 1;
+        }
+
+        std::cout << bytes
+            << "\t" << timePerByte(bytes, sink, [&data] { return streamEncode(data); })
+            << "\t\t" << timePerByte(bytes, sink, [&data] { return HexCodec::encode(data); })
+            << "\t\t" << timePerByte(bytes, sink, [&hexData] { return stoiDecode(hexData); })
+            << "\t\t" << timePerByte(bytes, sink, [&hexData] { return HexCodec::decode(hexData); })
+            << std::endl;
+    }
+
+    // Keep the results observable
+    return sink == 0 ? 1 : 0;
+}
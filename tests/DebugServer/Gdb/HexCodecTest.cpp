@@ -0,0 +1,82 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "src/DebugServer/Gdb/HexCodec.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+using Bloom::DebugServer::Gdb::HexCodec;
+
+namespace
+{
+    void expect(bool condition, const std::string& description) {
+        if (!condition) {
+            throw Bloom::Exceptions::Exception("Expectation failed: " + description);
+        }
+    }
+
+    /**
+     * Checks that decoding the given hex data throws an exception.
+     */
+    void expectRejected(const std::string& hexData, const std::string& description) {
+        try {
+            HexCodec::decode(hexData);
+
+        } catch (const Bloom::Exceptions::Exception&) {
+            return;
+        }
+
+        throw Bloom::Exceptions::Exception("Expectation failed: " + description);
+    }
+
+    void testRoundTrip() {
+        auto data = std::vector<unsigned char>();
+
+        for (auto value = 0; value < 256; value++) {
+            data.push_back(static_cast<unsigned char>(value));
+        }
+
+        const auto hexData = HexCodec::encode(data);
+
+        expect(hexData.size() == 512, "encodes each byte as two characters");
+        expect(hexData.substr(0, 6) == "000102", "encodes the first bytes in order");
+        expect(hexData.substr(hexData.size() - 4) == "feff", "encodes with lower case characters");
+        expect(HexCodec::decode(hexData) == data, "decodes every byte value back to the original data");
+
+        expect(HexCodec::encode(std::string("OK")) == "4f4b", "encodes string data");
+        expect(HexCodec::encode(std::vector<unsigned char>()).empty(), "encodes empty data");
+        expect(HexCodec::decode(std::string()).empty(), "decodes empty data");
+    }
+
+    void testMixedCaseDecode() {
+        const auto expected = std::vector<unsigned char>({0xAB, 0xCD, 0xEF, 0x9a});
+
+        expect(HexCodec::decode("abcdef9a") == expected, "decodes lower case characters");
+        expect(HexCodec::decode("ABCDEF9A") == expected, "decodes upper case characters");
+        expect(HexCodec::decode("aBcDeF9A") == expected, "decodes mixed case characters");
+    }
+
+    void testInvalidInput() {
+        expectRejected("abc", "odd-length data is rejected");
+        expectRejected("0", "a single character is rejected");
+        expectRejected("0g", "non-hexadecimal characters are rejected");
+        expectRejected("g0", "non-hexadecimal leading characters are rejected");
+        expectRejected("00 1", "whitespace is rejected");
+        expectRejected(std::string("0\0", 2), "null characters are rejected");
+        expectRejected("\xff" "0", "characters outside of the ASCII range are rejected");
+    }
+}
+
+int main() {
+    try {
+        testRoundTrip();
+        testMixedCaseDecode();
+        testInvalidInput();
+
+    } catch (const Bloom::Exceptions::Exception& exception) {
+        std::cerr << exception.getMessage() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "src/DebugToolDrivers/Simulator/AVR/Avr8Core.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+using Bloom::DebugToolDrivers::Simulation::Avr::Avr8Core;
+using Bloom::Targets::Microchip::Avr::Avr8Bit::TargetParameters;
+
+namespace
+{
+    constexpr std::uint32_t RAM_END_ADDRESS = 0x08FF;
+    constexpr std::uint32_t STATUS_REGISTER_ADDRESS = 0x5F;
+    constexpr std::uint32_t STACK_POINTER_ADDRESS = 0x5D;
+    constexpr std::uint8_t ZERO_FLAG = 0x02;
+
+    /**
+     * Target parameters for an ATmega328P - the registers and I/O space are mapped into the data address space.
+     */
+    TargetParameters getTargetParameters() {
+        auto parameters = TargetParameters();
+        parameters.flashSize = 0x8000;
+        parameters.flashStartAddress = 0x00;
+        parameters.flashPageSize = 128;
+        parameters.ramStartAddress = 0x0100;
+        parameters.ramSize = 0x0800;
+        parameters.eepromSize = 0x0400;
+        parameters.gpRegisterStartAddress = 0x00;
+        parameters.mappedIoSegmentStartAddress = 0x20;
+        parameters.statusRegisterStartAddress = STATUS_REGISTER_ADDRESS;
+        parameters.stackPointerRegisterLowAddress = STACK_POINTER_ADDRESS;
+        parameters.stackPointerRegisterSize = 2;
+
+        return parameters;
+    }
+
+    void loadProgram(Avr8Core& core, const std::vector<std::uint16_t>& program) {
+        auto& flash = core.getFlash();
+
+        for (auto i = std::size_t(0); i < program.size(); i++) {
+            flash[i * 2] = static_cast<std::uint8_t>(program[i]);
+            flash[(i * 2) + 1] = static_cast<std::uint8_t>(program[i] >> 8);
+        }
+    }
+
+    /**
+     * Steps the core until it executes a BREAK instruction.
+     *
+     * @return
+     *  The number of instructions executed, including the BREAK instruction.
+     */
+    std::uint32_t runToBreak(Avr8Core& core) {
+        for (auto count = std::uint32_t(1); count <= 1000; count++) {
+            if (core.step() == Avr8Core::StepResult::BREAK) {
+                return count;
+            }
+        }
+
+        throw Bloom::Exceptions::Exception("Core did not reach a BREAK instruction");
+    }
+
+    void expect(bool condition, const std::string& description) {
+        if (!condition) {
+            throw Bloom::Exceptions::Exception("Expectation failed: " + description);
+        }
+    }
+
+    void testArithmeticAndSubroutineCall() {
+        auto core = Avr8Core(getTargetParameters());
+
+        loadProgram(core, {
+            0xE005, // 0: LDI r16, 0x05
+            0xE013, // 1: LDI r17, 0x03
+            0x0F01, // 2: ADD r16, r17
+            0xD002, // 3: RCALL +2 (to 6)
+            0x5008, // 4: SUBI r16, 0x08
+            0x9598, // 5: BREAK
+            0xEA3A, // 6: LDI r19, 0xAA
+            0x9508, // 7: RET
+        });
+
+        expect(runToBreak(core) == 8, "executes eight instructions");
+        expect(core.getProgramCounter() == 6, "program counter is advanced past the BREAK instruction");
+
+        expect(core.readRegister(17) == 0x03, "LDI loads r17");
+        expect(core.readRegister(19) == 0xAA, "the subroutine was executed");
+        expect(core.readRegister(16) == 0x00, "ADD and SUBI produce zero in r16");
+        expect((core.readData(STATUS_REGISTER_ADDRESS) & ZERO_FLAG) != 0, "SUBI sets the zero flag");
+
+        const auto stackPointer = static_cast<std::uint32_t>(
+            core.readData(STACK_POINTER_ADDRESS) | (core.readData(STACK_POINTER_ADDRESS + 1) << 8)
+        );
+        expect(stackPointer == RAM_END_ADDRESS, "RET restores the stack pointer");
+    }
+
+    void testMappedRegistersAndReset() {
+        auto core = Avr8Core(getTargetParameters());
+
+        core.writeData(0x10, 0x42);
+        expect(core.readRegister(16) == 0x42, "r16 is mapped into the data address space");
+
+        core.setProgramCounter(0x20);
+        core.reset();
+
+        expect(core.getProgramCounter() == 0, "reset clears the program counter");
+        expect(core.readRegister(16) == 0x00, "reset clears the general purpose registers");
+    }
+
+    void testUnsupportedInstruction() {
+        auto core = Avr8Core(getTargetParameters());
+
+        // DES is only implemented on XMEGA targets
+        loadProgram(core, {0x940B});
+
+        try {
+            core.step();
+
+        } catch (const Bloom::Exceptions::Exception&) {
+            return;
+        }
+
+        throw Bloom::Exceptions::Exception("Expectation failed: unsupported instructions are rejected");
+    }
+}
+
+int main() {
+    try {
+        testArithmeticAndSubroutineCall();
+        testMappedRegistersAndReset();
+        testUnsupportedInstruction();
+
+    } catch (const Bloom::Exceptions::Exception& exception) {
+        std::cerr << exception.getMessage() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}